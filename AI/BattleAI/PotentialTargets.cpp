@@ -15,6 +15,9 @@ PotentialTargets::PotentialTargets(const CStack * attacker, const HypotheticChan
 	auto dists = getCbc()->battleGetDistances(attacker);
 	auto avHexes = getCbc()->battleGetAvailableHexes(attacker, false);
 
+	//the same pair of stacks is evaluated for every hex from which attack is possible
+	DamageStatsCache damageCache;
+
 	for(const CStack *enemy : getCbc()->battleGetStacks())
 	{
 		//Consider only stacks of different owner
@@ -33,7 +36,7 @@ PotentialTargets::PotentialTargets(const CStack * attacker, const HypotheticChan
 				bai.chargedFields = dists[hex];
 			}
 
-			return AttackPossibility::evaluate(bai, state, hex);
+			return AttackPossibility::evaluate(bai, state, hex, damageCache);
 		};
 
 		if(getCbc()->battleCanShoot(attacker, enemy->position))
@@ -301,8 +301,6 @@ Goals::TSubgoal FuzzyHelper::chooseSolution (Goals::TGoalVec vec)
 	if (vec.empty()) //no possibilities found
 		return sptr(Goals::Invalid());
 
-	ai->cachedSectorMaps.clear();
-
 	//a trick to switch between heroes less often - calculatePaths is costly
 	auto sortByHeroes = [](const Goals::TSubgoal & lhs, const Goals::TSubgoal & rhs) -> bool
 	{
@@ -312,7 +310,9 @@ Goals::TSubgoal FuzzyHelper::chooseSolution (Goals::TGoalVec vec)
 
 	for (auto g : vec)
 	{
+		auto start = boost::posix_time::microsec_clock::universal_time();
 		setPriority(g);
+		addEvaluationTime(g->goalType, (boost::posix_time::microsec_clock::universal_time() - start).total_microseconds());
 	}
 
 	auto compareGoals = [](const Goals::TSubgoal & lhs, const Goals::TSubgoal & rhs) -> bool
@@ -324,6 +324,22 @@ Goals::TSubgoal FuzzyHelper::chooseSolution (Goals::TGoalVec vec)
 	return vec.back();
 }
 
+void FuzzyHelper::addEvaluationTime(Goals::EGoals goalType, si64 microseconds)
+{
+	auto & entry = evaluationTimes[goalType];
+	entry.count++;
+	entry.microseconds += microseconds;
+}
+
+void FuzzyHelper::logEvaluationTimes()
+{
+	for (auto & entry : evaluationTimes)
+	{
+		logAi->debug("Goal type %d: %d evaluations took %d ms", static_cast<int>(entry.first), entry.second.count, entry.second.microseconds / 1000);
+	}
+	evaluationTimes.clear();
+}
+
 float FuzzyHelper::evaluate (Goals::Explore & g)
 {
 	return 1;
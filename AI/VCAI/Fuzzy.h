@@ -55,7 +55,15 @@ class FuzzyHelper
 		~EvalVisitTile();
 	} vt;
 
-	
+	struct EvaluationTime
+	{
+		ui32 count;
+		si64 microseconds;
+		EvaluationTime() : count(0), microseconds(0) {}
+	};
+	std::map<Goals::EGoals, EvaluationTime> evaluationTimes; //since last logEvaluationTimes call
+
+	void addEvaluationTime(Goals::EGoals goalType, si64 microseconds);
 
 public:
 	enum RuleBlocks {BANK_DANGER, TACTICAL_ADVANTAGE, VISIT_TILE};
@@ -83,5 +91,6 @@ public:
 	float getTacticalAdvantage (const CArmedInstance *we, const CArmedInstance *enemy); //returns factor how many times enemy is stronger than us
 
 	Goals::TSubgoal chooseSolution (Goals::TGoalVec vec);
+	void logEvaluationTimes(); //prints and resets time spent on goal evaluation, by goal type
 	//std::shared_ptr<AbstractGoal> chooseSolution (std::vector<std::shared_ptr<AbstractGoal>> & vec);
 };
@@ -85,6 +85,7 @@ VCAI::VCAI(void)
 {
 	LOG_TRACE(logAi);
 	makingTurn = nullptr;
+	sectorMapsRevision = 0;
 	destinationTeleport = ObjectInstanceID();
 	destinationTeleportPos = int3(-1);
 }
@@ -108,7 +109,7 @@ void VCAI::heroMoved(const TryMoveHero & details)
 
 	validateObject(details.id); //enemy hero may have left visible area
 	auto hero = cb->getHero(details.id);
-	cachedSectorMaps.clear();
+	invalidateSectorMaps();
 
 	const int3 from = CGHeroInstance::convertPosition(details.start, false),
 		to = CGHeroInstance::convertPosition(details.end, false);
@@ -396,7 +397,7 @@ void VCAI::newObject(const CGObjectInstance * obj)
 	if(obj->isVisitable())
 		addVisitableObj(obj);
 
-	cachedSectorMaps.clear();
+	invalidateSectorMaps();
 }
 
 void VCAI::objectRemoved(const CGObjectInstance *obj)
@@ -423,7 +424,7 @@ void VCAI::objectRemoved(const CGObjectInstance *obj)
 		}
 	}
 
-	cachedSectorMaps.clear(); //invalidate all paths
+	invalidateSectorMaps(); //invalidate all paths
 
 	//TODO
 	//there are other places where CGObjectinstance ptrs are stored...
@@ -593,10 +594,21 @@ void VCAI::init(std::shared_ptr<CCallback> CB)
 	retreiveVisitableObjs();
 }
 
+void VCAI::playerStartsTurn(PlayerColor player)
+{
+	LOG_TRACE_PARAMS(logAi, "player '%s'", player);
+	NET_EVENT_HANDLER;
+
+	if(player != playerID && !planningAhead && settings["server"]["aiPlanAhead"].Bool())
+		planningAhead = make_unique<boost::thread>(&VCAI::planAhead, this);
+}
+
 void VCAI::yourTurn()
 {
 	LOG_TRACE(logAi);
 	NET_EVENT_HANDLER;
+	stopPlanningAhead();
+	adoptPlannedSectorMaps();
 	status.startedTurn();
 	makingTurn = make_unique<boost::thread>(&VCAI::makeTurn, this);
 }
@@ -776,8 +788,11 @@ void VCAI::makeTurn()
 	}
 	markHeroAbleToExplore (primaryHero());
 
+	const auto turnStart = boost::posix_time::microsec_clock::universal_time();
 	makeTurnInternal();
+	const auto turnTime = boost::posix_time::microsec_clock::universal_time() - turnStart;
 
+	logGlobal->info("Player %d (%s) finished turn in %d ms", playerID, playerID.getStr(), turnTime.total_milliseconds());
 	return;
 }
 
@@ -882,6 +897,7 @@ void VCAI::makeTurnInternal()
 		logAi->debug("Making turn thread has caught an exception: %s", e.what());
 	}
 
+	fh->logEvaluationTimes();
 	endTurn();
 }
 
@@ -1747,7 +1763,7 @@ bool VCAI::isAbleToExplore (HeroPtr h)
 void VCAI::clearPathsInfo()
 {
 	heroesUnableToExplore.clear();
-	cachedSectorMaps.clear();
+	invalidateSectorMaps();
 }
 
 void VCAI::validateVisitableObjs()
@@ -1979,6 +1995,19 @@ bool VCAI::moveHeroToTile(int3 dst, HeroPtr h)
 			afterMovementCheck();
 		};
 
+		//step onto node j that needs no special handling: no teleport on it and no transit through it
+		auto isPlainStep = [&](int j) -> bool
+		{
+			if(path.nodes[j].turns || isTeleportAction(path.nodes[j].action))
+				return false;
+
+			auto nodeObject = getObj(path.nodes[j].coord, false);
+			if(CGTeleport::isTeleport(nodeObject))
+				return false;
+
+			return !(j > 0 && CGTeleport::isConnected(nodeObject, getObj(path.nodes[j-1].coord, false)));
+		};
+
 		auto doChannelProbing = [&]() -> void
 		{
 			auto currentPos = CGHeroInstance::convertPosition(h->pos,false);
@@ -2023,6 +2052,25 @@ bool VCAI::moveHeroToTile(int3 dst, HeroPtr h)
 			if(endpos == h->visitablePos())
 				continue;
 
+			if(isPlainStep(i-1))
+			{
+				//send whole run of plain steps at once, server will stop on first interruption
+				int last = i-1;
+				while(last > 0 && isPlainStep(last-1))
+					last--;
+
+				CGPath subPath;
+				subPath.nodes.assign(path.nodes.begin() + last, path.nodes.begin() + i + 1);
+				cb->moveHero(*h, subPath);
+				afterMovementCheck();
+
+				if(h->visitablePos() != path.nodes[last].coord)
+					break; //movement was interrupted, leave the rest for next decision
+
+				i = last + 1;
+				continue;
+			}
+
 			if((i-2 >= 0) // Check there is node after next one; otherwise transit is pointless
 				&& (CGTeleport::isConnected(nextObjectTop, getObj(path.nodes[i-2].coord, false))
 					|| CGTeleport::isTeleport(nextObjectTop)))
@@ -2794,6 +2842,7 @@ void VCAI::recruitHero(const CGTownInstance * t, bool throwing)
 
 void VCAI::finish()
 {
+	stopPlanningAhead();
 	if(makingTurn)
 	{
 		makingTurn->interrupt();
@@ -2897,11 +2946,107 @@ std::shared_ptr<SectorMap> VCAI::getCachedSectorMap(HeroPtr h)
 		return it->second;
 	else
 	{
-		cachedSectorMaps[h] = std::make_shared<SectorMap>(h);
-		return cachedSectorMaps[h];
+		//sectors don't depend on hero, so they are computed once and only paths are searched for each hero
+		if(!cachedSectorLabels)
+			cachedSectorLabels = std::make_shared<SectorMap>();
+
+		auto sm = std::make_shared<SectorMap>(*cachedSectorLabels, h);
+		cachedSectorMaps[h] = sm;
+		return sm;
+	}
+}
+
+void VCAI::invalidateSectorMaps()
+{
+	cachedSectorMaps.clear();
+	cachedSectorLabels.reset();
+	sectorMapsRevision++;
+}
+
+void VCAI::planAhead()
+{
+	SET_GLOBAL_STATE(this);
+	setThreadName("VCAI::planAhead");
+
+	ui32 plannedRevision = sectorMapsRevision - 1;
+	try
+	{
+		while(true)
+		{
+			if(plannedRevision != sectorMapsRevision)
+			{
+				plannedRevision = sectorMapsRevision;
+
+				std::vector<ObjectInstanceID> heroes;
+				{
+					boost::shared_lock<boost::shared_mutex> gsLock(CGameState::mutex);
+					for(auto h : cb->getHeroesInfo())
+						heroes.push_back(h->id);
+				}
+
+				std::shared_ptr<SectorMap> labels;
+				for(auto id : heroes)
+				{
+					boost::this_thread::interruption_point();
+					if(plannedRevision != sectorMapsRevision)
+						break; //something has changed, start over
+
+					boost::shared_lock<boost::shared_mutex> gsLock(CGameState::mutex);
+					const CGHeroInstance * h = cb->getHero(id);
+					if(!h)
+						continue;
+
+					if(!labels)
+						labels = std::make_shared<SectorMap>();
+					auto sm = std::make_shared<SectorMap>(*labels, HeroPtr(h));
+					boost::unique_lock<boost::mutex> lock(plannedSectorMapsMx);
+					plannedSectorMaps[HeroPtr(h)] = std::make_pair(plannedRevision, sm);
+				}
+			}
+			boost::this_thread::sleep(boost::posix_time::milliseconds(50));
+		}
+	}
+	catch(boost::thread_interrupted &)
+	{
+		logAi->debug("Planning ahead stopped");
+	}
+	catch(std::exception & e)
+	{
+		logAi->error("Planning ahead failed: %s", e.what());
+		boost::unique_lock<boost::mutex> lock(plannedSectorMapsMx);
+		plannedSectorMaps.clear();
 	}
 }
 
+void VCAI::stopPlanningAhead()
+{
+	if(planningAhead)
+	{
+		planningAhead->interrupt();
+		planningAhead->join();
+		planningAhead.reset();
+	}
+}
+
+void VCAI::adoptPlannedSectorMaps()
+{
+	boost::unique_lock<boost::mutex> lock(plannedSectorMapsMx);
+	int reused = 0;
+	for(auto & planned : plannedSectorMaps)
+	{
+		//map is still valid only if nothing has changed since it was computed
+		if(planned.second.first == sectorMapsRevision && !vstd::contains(cachedSectorMaps, planned.first))
+		{
+			cachedSectorMaps[planned.first] = planned.second.second;
+			reused++;
+		}
+	}
+	plannedSectorMaps.clear();
+
+	if(reused)
+		logAi->debug("Reused %d sector maps computed during turns of other players", reused);
+}
+
 AIStatus::AIStatus()
 {
 	battle = NO_BATTLE;
@@ -3066,6 +3211,15 @@ SectorMap::SectorMap(HeroPtr h)
 	makeParentBFS(h->visitablePos());
 }
 
+SectorMap::SectorMap(const SectorMap & labels, HeroPtr h):
+	valid(labels.valid),
+	sector(labels.sector),
+	infoOnSectors(labels.infoOnSectors),
+	visibleTiles(labels.visibleTiles)
+{
+	makeParentBFS(h->visitablePos());
+}
+
 bool SectorMap::markIfBlocked(TSectorID &sec, crint3 pos, const TerrainTile *t)
 {
 	if(t->blocked && !t->visitable)
@@ -3090,6 +3244,8 @@ void SectorMap::update()
 
 	clear();
 	int curSector = 3; //0 is invisible, 1 is not explored
+	infoOnSectors.clear();
+	infoOnSectors.resize(curSector);
 
 	CCallback * cbp = cb.get(); //optimization
 	foreach_tile_pos([&](crint3 pos)
@@ -3100,6 +3256,7 @@ void SectorMap::update()
 				exploreNewSector(pos, curSector++, cbp);
 		}
 	});
+	assert(infoOnSectors.size() == static_cast<size_t>(curSector));
 	valid = true;
 }
 
@@ -3134,6 +3291,8 @@ void SectorMap::clear()
 
 void SectorMap::exploreNewSector(crint3 pos, int num, CCallback * cbp)
 {
+	if(infoOnSectors.size() <= static_cast<size_t>(num))
+		infoOnSectors.resize(num + 1);
 	Sector &s = infoOnSectors[num];
 	s.id = num;
 	s.water = getTile(pos)->isWater();
@@ -3510,11 +3669,11 @@ int3 SectorMap::findFirstVisitableTile (HeroPtr h, crint3 dst)
 		}
 		else
 		{
-			auto i = parent.find(curtile);
-			if(i != parent.end())
+			const int3 prev = cb->isInTheMap(curtile) ? parent[curtile.x][curtile.y][curtile.z] : int3(-1, -1, -1);
+			if(prev.valid())
 			{
-				assert(curtile != i->second);
-				curtile = i->second;
+				assert(curtile != prev);
+				curtile = prev;
 			}
 			else
 			{
@@ -3528,11 +3687,14 @@ int3 SectorMap::findFirstVisitableTile (HeroPtr h, crint3 dst)
 
 void SectorMap::makeParentBFS(crint3 source)
 {
-	parent.clear();
+	auto shape = sector.shape();
+	parent.resize(boost::extents[shape[0]][shape[1]][shape[2]]);
+	std::fill(parent.data(), parent.data() + parent.num_elements(), int3(-1, -1, -1));
 
 	int mySector = retreiveTile(source);
 	std::queue<int3> toVisit;
 	toVisit.push(source);
+	parent[source.x][source.y][source.z] = source; //mark as visited, path search stops at hero position
 	while(!toVisit.empty())
 	{
 		int3 curPos = toVisit.front();
@@ -3543,12 +3705,12 @@ void SectorMap::makeParentBFS(crint3 source)
 
 		foreach_neighbour(curPos, [&](crint3 neighPos)
 		{
-			if(retreiveTile(neighPos) == mySector && !vstd::contains(parent, neighPos))
+			if(retreiveTile(neighPos) == mySector && !parent[neighPos.x][neighPos.y][neighPos.z].valid())
 			{
 				if (cb->canMoveBetween(curPos, neighPos))
 				{
 					toVisit.push(neighPos);
-					parent[neighPos] = curPos;
+					parent[neighPos.x][neighPos.y][neighPos.z] = curPos;
 				}
 			}
 		});
@@ -93,15 +93,16 @@ struct SectorMap
 	typedef boost::multi_array<TSectorID, 3> TSectorArray;
 
 	bool valid; //some kind of lazy eval
-	std::map<int3, int3> parent;
+	boost::multi_array<int3, 3> parent; //previous tile on path from hero, invalid int3 if tile is not reachable
 	TSectorArray sector;
 	//std::vector<std::vector<std::vector<unsigned char>>> pathfinderSector;
 
-	std::map<int, Sector> infoOnSectors;
+	std::vector<Sector> infoOnSectors; //indexed by sector id, contains empty entries for special values
 	std::shared_ptr<boost::multi_array<TerrainTile*, 3>> visibleTiles;
 
 	SectorMap();
 	SectorMap(HeroPtr h);
+	SectorMap(const SectorMap & labels, HeroPtr h); //reuses sectors from map computed for another hero
 	void update();
 	void clear();
 	void exploreNewSector(crint3 pos, int num, CCallback * cbp);
@@ -155,6 +156,13 @@ public:
 	std::set<const CGObjectInstance *> reservedObjs; //to be visited by specific hero
 
 	std::map <HeroPtr, std::shared_ptr<SectorMap>> cachedSectorMaps; //TODO: serialize? not necessary
+	std::shared_ptr<SectorMap> cachedSectorLabels; //sectors without hero-specific data, shared by all cached maps
+	std::atomic<ui32> sectorMapsRevision; //incremented every time cached sector maps become outdated
+
+	//sector maps computed in background during turns of other players, together with revision they were computed for
+	std::map<HeroPtr, std::pair<ui32, std::shared_ptr<SectorMap>>> plannedSectorMaps;
+	boost::mutex plannedSectorMapsMx;
+	std::unique_ptr<boost::thread> planningAhead;
 
 	TResources saving;
 
@@ -189,6 +197,7 @@ public:
 	virtual std::string getBattleAIName() const override;
 
 	virtual void init(std::shared_ptr<CCallback> CB) override;
+	virtual void playerStartsTurn(PlayerColor player) override;
 	virtual void yourTurn() override;
 
 	virtual void heroGotLevel(const CGHeroInstance *hero, PrimarySkill::PrimarySkill pskill, std::vector<SecondarySkill> &skills, QueryID queryID) override; //pskill is gained primary skill, interface has to choose one of given skills and call callback with selection id
@@ -309,6 +318,12 @@ public:
 	bool isAccessibleForHero(const int3 & pos, HeroPtr h, bool includeAllies = false) const;
 	//optimization - use one SM for every hero call
 	std::shared_ptr<SectorMap> getCachedSectorMap(HeroPtr h);
+	void invalidateSectorMaps();
+
+	//precomputes data for our next turn while other players move, only if enabled in settings
+	void planAhead();
+	void stopPlanningAhead();
+	void adoptPlannedSectorMaps();
 
 	const CGTownInstance *findTownWithTavern() const;
 	bool canRecruitAnyHero(const CGTownInstance * t = NULL) const;
@@ -43,6 +43,26 @@ bool CCallback::moveHero(const CGHeroInstance *h, int3 dst, bool transit)
 	return true;
 }
 
+bool CCallback::moveHero(const CGHeroInstance *h, const CGPath & path)
+{
+	MoveHeroPath pack(h->id);
+	//nodes are stored from destination to start, first node is hero position
+	for(int i = (int)path.nodes.size() - 2; i >= 0; i--)
+	{
+		const CGPathNode & node = path.nodes[i];
+		if(node.turns)
+			break;
+
+		pack.steps.push_back({CGHeroInstance::convertPosition(node.coord, true), node.layer == EPathfindingLayer::AIR});
+	}
+
+	if(pack.steps.empty())
+		return false;
+
+	sendRequest(&pack);
+	return true;
+}
+
 int CCallback::selectionMade(int selection, QueryID queryID)
 {
 	JsonNode reply(JsonNode::JsonType::DATA_INTEGER);
@@ -649,6 +649,36 @@ void processCommand(const std::string &message)
 	{
 		GH.totalRedraw();
 	}
+	else if(cn == "framestats")
+	{
+		std::string what;
+		readed >> what;
+		if(what == "reset")
+		{
+			GH.frameStats.reset();
+		}
+		else if(what == "save")
+		{
+			const boost::filesystem::path path = VCMIDirs::get().userCachePath() / "frameTimes.txt";
+			GH.frameStats.save(path);
+			std::cout << "Frame statistics saved to " << path.string() << std::endl;
+		}
+		else
+		{
+			std::cout << GH.frameStats.summary() << std::endl;
+		}
+	}
+	else if(cn == "packstats")
+	{
+		std::string what;
+		readed >> what;
+		if(!client)
+			std::cout << "No game in progress" << std::endl;
+		else if(what == "reset")
+			client->packStats.reset();
+		else
+			std::cout << client->packStats.summary();
+	}
 	else if(cn=="screen")
 	{
 		std::cout << "Screenbuf points to ";
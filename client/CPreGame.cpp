@@ -1117,12 +1117,13 @@ void SelectionTab::parseMaps(const std::unordered_set<ResourceID> &files)
 {
 	logGlobal->debug("Parsing %d maps", files.size());
 	allItems.clear();
+	CMapHeaderCache headerCache(VCMIDirs::get().userCachePath() / "mapHeaders.bin");
 	for(auto & file : files)
 	{
 		try
 		{
 			CMapInfo mapInfo;
-			mapInfo.mapInit(file.getName());
+			headerCache.mapInit(mapInfo, file.getName());
 
 			// ignore unsupported map versions (e.g. WoG maps without WoG)
 			// but accept VCMI maps
@@ -1134,6 +1135,7 @@ void SelectionTab::parseMaps(const std::unordered_set<ResourceID> &files)
 			logGlobal->error("Map %s is invalid. Message: %s", file.getName(), e.what());
 		}
 	}
+	headerCache.save();
 }
 
 void SelectionTab::parseGames(const std::unordered_set<ResourceID> &files, CMenuScreen::EGameMode gameMode)
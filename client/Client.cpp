@@ -185,6 +185,9 @@ void CClient::run()
 				break;
 			}
 
+			if(pack)
+				packStats.addReceived(typeid(*pack).name(), serv->lastPackWaitTime.total_microseconds(), serv->lastPackDecodeTime.total_microseconds());
+
 			handlePack(pack);
 		}
 	}
@@ -677,13 +680,17 @@ void CClient::handlePack( CPack * pack )
 	CBaseForCLApply *apply = applier->getApplier(typeList.getTypeID(pack)); //find the applier
 	if(apply)
 	{
+		const auto lockStart = boost::posix_time::microsec_clock::universal_time();
 		boost::unique_lock<boost::recursive_mutex> guiLock(*CPlayerInterface::pim);
+		const auto applyStart = boost::posix_time::microsec_clock::universal_time();
 		apply->applyOnClBefore(this, pack);
 		logNetwork->trace("\tMade first apply on cl");
 		gs->apply(pack);
 		logNetwork->trace("\tApplied on gs");
 		apply->applyOnClAfter(this, pack);
 		logNetwork->trace("\tMade second apply on cl");
+		const auto applyEnd = boost::posix_time::microsec_clock::universal_time();
+		packStats.addApplied(typeid(*pack).name(), (applyStart - lockStart).total_microseconds(), (applyEnd - applyStart).total_microseconds());
 	}
 	else
 	{
@@ -1200,3 +1207,52 @@ extern "C" JNIEXPORT bool JNICALL Java_eu_vcmi_vcmi_NativeMethods_tryToSaveTheGa
 	return true;
 }
 #endif
+
+CPackStats::Entry::Entry():
+	count(0), networkWaitTime(0), decodeTime(0), lockWaitTime(0), applyTime(0), longestApply(0)
+{
+}
+
+void CPackStats::addReceived(const std::string & type, ui64 networkWaitTime, ui64 decodeTime)
+{
+	TLockGuard _(mx);
+	Entry & entry = entries[type];
+	entry.networkWaitTime += networkWaitTime;
+	entry.decodeTime += decodeTime;
+}
+
+void CPackStats::addApplied(const std::string & type, ui64 lockWaitTime, ui64 applyTime)
+{
+	TLockGuard _(mx);
+	Entry & entry = entries[type];
+	entry.count++;
+	entry.lockWaitTime += lockWaitTime;
+	entry.applyTime += applyTime;
+	vstd::amax(entry.longestApply, applyTime);
+}
+
+void CPackStats::reset()
+{
+	TLockGuard _(mx);
+	entries.clear();
+}
+
+std::string CPackStats::summary() const
+{
+	TLockGuard _(mx);
+	std::vector<std::pair<std::string, Entry>> sorted(entries.begin(), entries.end());
+	boost::sort(sorted, [](const std::pair<std::string, Entry> & a, const std::pair<std::string, Entry> & b)
+	{
+		return a.second.decodeTime + a.second.lockWaitTime + a.second.applyTime > b.second.decodeTime + b.second.lockWaitTime + b.second.applyTime;
+	});
+
+	std::ostringstream out;
+	for(auto & elem : sorted)
+	{
+		const Entry & e = elem.second;
+		const ui64 count = std::max<ui64>(e.count, 1);
+		out << boost::format("%s: %d packs, avg decode %d us, avg lock wait %d us, avg apply %d us, longest apply %d us, avg network wait %d us\n")
+			% elem.first % e.count % (e.decodeTime / count) % (e.lockWaitTime / count) % (e.applyTime / count) % e.longestApply % (e.networkWaitTime / count);
+	}
+	return out.str();
+}
@@ -119,6 +119,31 @@ public:
 	}
 };
 
+/// Timing statistics of packs received from server, grouped by pack type
+class CPackStats
+{
+	struct Entry
+	{
+		ui64 count;
+		ui64 networkWaitTime; // waiting for pack to arrive, mostly idle time, in microseconds
+		ui64 decodeTime; // reading and deserialization of the pack
+		ui64 lockWaitTime; // waiting for interface lock
+		ui64 applyTime; // applying on game state and interfaces
+		ui64 longestApply;
+
+		Entry();
+	};
+
+	std::map<std::string, Entry> entries;
+	mutable boost::mutex mx;
+public:
+	void addReceived(const std::string & type, ui64 networkWaitTime, ui64 decodeTime);
+	void addApplied(const std::string & type, ui64 lockWaitTime, ui64 applyTime);
+	void reset();
+
+	std::string summary() const; // one line per pack type, sorted by time spent processing (without network wait)
+};
+
 /// Class which handles client - server logic
 class CClient : public IGameCallback
 {
@@ -174,6 +199,7 @@ public:
 
 	bool terminate;	// tell to terminate
 	std::unique_ptr<boost::thread> connectionHandler; //thread running run() method
+	CPackStats packStats;
 	boost::mutex connectionHandlerMutex;
 
 	//////////////////////////////////////////////////////////////////////////
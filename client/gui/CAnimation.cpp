@@ -49,7 +49,7 @@ private:
 	//offset[group][frame] - offset of frame data in file
 	std::map<size_t, std::vector <size_t> > offset;
 
-	std::unique_ptr<ui8[]>       data;
+	std::shared_ptr<const ui8>   data;
 	std::unique_ptr<SDL_Color[]> palette;
 
 public:
@@ -208,47 +208,81 @@ public:
 	~CompImageLoader();
 };
 
-// Extremely simple file cache. TODO: smarter, more general solution
+/// LRU cache of raw animation files, bounded by total size of cached data
+/// Cached files are shared between all users and never copied or modified
 class CFileCache
 {
-	static const int cacheSize = 50; //Max number of cached files
+	static const size_t cacheLimit = 16 * 1024 * 1024; //Max size of cached data, in bytes
+	static const ui32 statisticsInterval = 1000; //Report hit/miss statistics each N requests
+
 	struct FileData
 	{
-		ResourceID             name;
-		size_t                 size;
-		std::unique_ptr<ui8[]> data;
+		ResourceID               name;
+		size_t                   size;
+		std::shared_ptr<const ui8> data;
 
-		std::unique_ptr<ui8[]> getCopy()
-		{
-			auto ret = std::unique_ptr<ui8[]>(new ui8[size]);
-			std::copy(data.get(), data.get() + size, ret.get());
-			return ret;
-		}
-		FileData(ResourceID name_, size_t size_, std::unique_ptr<ui8[]> data_):
+		FileData(ResourceID name_, size_t size_, std::shared_ptr<const ui8> data_):
 			name{std::move(name_)},
 			size{size_},
 			data{std::move(data_)}
 		{}
 	};
 
-	std::deque<FileData> cache;
+	//most recently used files are in the front
+	std::list<FileData> cache;
+	std::unordered_map<ResourceID, std::list<FileData>::iterator> index;
+	size_t cachedBytes;
+
+	ui32 hits;
+	ui32 misses;
+
+	void evict()
+	{
+		//always keep at least one file, even if it does not fit in limit
+		while(cachedBytes > cacheLimit && cache.size() > 1)
+		{
+			cachedBytes -= cache.back().size;
+			index.erase(cache.back().name);
+			cache.pop_back();
+		}
+	}
+
+	void reportStatistics() const
+	{
+		if((hits + misses) % statisticsInterval == 0)
+			logAnim->debug("Animation file cache: %d hits, %d misses, %d files (%d bytes) cached", hits, misses, cache.size(), cachedBytes);
+	}
+
 public:
-	std::unique_ptr<ui8[]> getCachedFile(ResourceID rid)
+	CFileCache():
+		cachedBytes(0),
+		hits(0),
+		misses(0)
+	{}
+
+	std::shared_ptr<const ui8> getCachedFile(const ResourceID & rid)
 	{
-		for(auto & file : cache)
+		auto iter = index.find(rid);
+		if(iter != index.end())
 		{
-			if (file.name == rid)
-				return file.getCopy();
+			hits++;
+			cache.splice(cache.begin(), cache, iter->second);
+			reportStatistics();
+			return iter->second->data;
 		}
 		// Still here? Cache miss
-		if (cache.size() > cacheSize)
-			cache.pop_front();
+		misses++;
 
-		auto data =  CResourceHandler::get()->load(rid)->readAll();
+		auto readData = CResourceHandler::get()->load(rid)->readAll();
+		std::shared_ptr<const ui8> data(readData.first.release(), std::default_delete<ui8[]>());
 
-		cache.emplace_back(std::move(rid), data.second, std::move(data.first));
+		cache.emplace_front(rid, readData.second, data);
+		index[rid] = cache.begin();
+		cachedBytes += readData.second;
 
-		return cache.back().getCopy();
+		evict();
+		reportStatistics();
+		return data;
 	}
 };
 
@@ -323,9 +357,9 @@ CDefFile::CDefFile(std::string Name):
 
 	for (ui32 i= 0; i<256; i++)
 	{
-		palette[i].r = data[it++];
-		palette[i].g = data[it++];
-		palette[i].b = data[it++];
+		palette[i].r = data.get()[it++];
+		palette[i].g = data.get()[it++];
+		palette[i].b = data.get()[it++];
 		palette[i].a = SDL_ALPHA_OPAQUE;
 	}
 
@@ -1195,6 +1229,15 @@ void CompImage::BlitBlock(ui8 type, ui8 size, ui8 *&data, ui8 *&dest, ui8 alpha)
 			return;
 		}
 
+		if (bpp == 4)
+		{
+			//Handles both opaque and semi-transparent blocks
+			CSDL_Ext::blitPaletteRow4bpp(palette, data, dest, size);
+			data += size;
+			dest += size * bpp;
+			return;
+		}
+
 		if (palette[color].a == 255)
 		{
 			//Put row of RGB data
@@ -438,9 +438,14 @@ void CGuiHandler::renderFrame()
 	// that will notify us about the ending game by setting terminate_cond flag.
 	//in PreGame terminate_cond stay false
 
+	const ui32 waitStart = SDL_GetTicks();
 	bool acquiredTheLockOnPim = false; //for tracking whether pim mutex locking succeeded
 	while(!terminate_cond->get() && !(acquiredTheLockOnPim = CPlayerInterface::pim->try_lock())) //try acquiring long until it succeeds or we are told to terminate
 		boost::this_thread::sleep(boost::posix_time::milliseconds(15));
+	const ui32 stallTime = SDL_GetTicks() - waitStart;
+
+	if(stallTime >= 500)
+		logGlobal->debug("Rendering was blocked by interface lock for %d ms", stallTime);
 
 	if(acquiredTheLockOnPim)
 	{
@@ -459,6 +464,11 @@ void CGuiHandler::renderFrame()
 		SDL_RenderCopy(mainRenderer, screenTexture, nullptr, nullptr);
 
 		SDL_RenderPresent(mainRenderer);
+
+		const ui32 currentTicks = SDL_GetTicks();
+		if(lastFrameTicks != 0)
+			frameStats.addFrame(currentTicks - lastFrameTicks, stallTime);
+		lastFrameTicks = currentTicks;
 	}
 
 	mainFPSmng->framerateDelay(); // holds a constant FPS
@@ -469,6 +479,7 @@ CGuiHandler::CGuiHandler()
 	: lastClick(-500, -500),lastClickTime(0), defActionsDef(0), captureChildren(false)
 {
 	continueEventHandling = true;
+	lastFrameTicks = 0;
 	curInt = nullptr;
 	current = nullptr;
 	statusbar = nullptr;
@@ -622,3 +633,69 @@ void CFramerateManager::framerateDelay()
 
 	lastticks = SDL_GetTicks();
 }
+
+CFrameTimeStats::CFrameTimeStats()
+{
+	reset();
+}
+
+void CFrameTimeStats::reset()
+{
+	TLockGuard _(mx);
+	histogram.assign(MAX_TRACKED_TIME + 1, 0);
+	frames = 0;
+	stalls = 0;
+	longestStall = 0;
+	totalStallTime = 0;
+}
+
+void CFrameTimeStats::addFrame(ui32 frameTime, ui32 stallTime)
+{
+	TLockGuard _(mx);
+	histogram[frameTime < MAX_TRACKED_TIME ? frameTime : MAX_TRACKED_TIME]++;
+	frames++;
+	if(stallTime > 0)
+	{
+		stalls++;
+		totalStallTime += stallTime;
+		vstd::amax(longestStall, stallTime);
+	}
+}
+
+ui32 CFrameTimeStats::percentile(double fraction) const
+{
+	const ui64 target = std::ceil(frames * fraction);
+	ui64 counted = 0;
+	for(ui32 time = 0; time < histogram.size(); time++)
+	{
+		counted += histogram[time];
+		if(counted >= target && counted > 0)
+			return time;
+	}
+	return 0;
+}
+
+std::string CFrameTimeStats::summary() const
+{
+	TLockGuard _(mx);
+	boost::format fmt("Frames: %d, frame time p50: %d ms, p95: %d ms, p99: %d ms, max: %d ms; waited for interface lock %d times, %d ms total, longest: %d ms");
+	ui32 longestFrame = 0;
+	for(ui32 time = 0; time < histogram.size(); time++)
+		if(histogram[time])
+			longestFrame = time;
+
+	fmt % frames % percentile(0.5) % percentile(0.95) % percentile(0.99) % longestFrame % stalls % totalStallTime % longestStall;
+	return fmt.str();
+}
+
+void CFrameTimeStats::save(const boost::filesystem::path & file) const
+{
+	std::ofstream out(file.string());
+	out << summary() << "\n";
+
+	TLockGuard _(mx);
+	out << "ms;frames\n";
+	for(ui32 time = 0; time < histogram.size(); time++)
+		if(histogram[time])
+			out << time << (time == MAX_TRACKED_TIME ? "+" : "") << ";" << histogram[time] << "\n";
+}
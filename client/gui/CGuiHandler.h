@@ -39,16 +39,42 @@ public:
 	ui32 getElapsedMilliseconds() const {return this->timeElapsed;}
 };
 
+// Collects durations of frames rendered by main loop and of waits for interface lock, to find stutters
+// Thread-safe, so statistics can be queried from console thread
+class CFrameTimeStats
+{
+	static const ui32 MAX_TRACKED_TIME = 1000; // all frames longer than this (in ms) are counted in last bucket
+
+	std::vector<ui32> histogram; // number of frames for each frame duration in ms
+	ui32 frames;
+	ui32 stalls; // number of frames that had to wait for interface lock
+	ui32 longestStall;
+	ui64 totalStallTime;
+	mutable boost::mutex mx;
+
+	ui32 percentile(double fraction) const; // mutex must be locked by caller
+public:
+	CFrameTimeStats();
+
+	void addFrame(ui32 frameTime, ui32 stallTime);
+	void reset();
+
+	std::string summary() const; // frame count, p50/p95/p99 frame times and lock waits
+	void save(const boost::filesystem::path & file) const; // summary followed by full histogram
+};
+
 // Handles GUI logic and drawing
 class CGuiHandler
 {
 public:
 	CFramerateManager * mainFPSmng; //to keep const framerate
+	CFrameTimeStats frameStats;
 	std::list<IShowActivatable *> listInt; //list of interfaces - front=foreground; back = background (includes adventure map, window interfaces, all kind of active dialogs, and so on)
 	CGStatusBar * statusbar;
 
 private:
 	std::atomic<bool> continueEventHandling;
+	ui32 lastFrameTicks; //when last frame was presented, used for frame statistics
 	typedef std::list<CIntObject*> CIntObjectList;
 
 	//active GUI elements (listening for events
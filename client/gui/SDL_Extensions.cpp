@@ -16,6 +16,11 @@
 #include "../Graphics.h"
 #include "../CMT.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VCMI_BLIT_SSE2
+#include <emmintrin.h>
+#endif
+
 const SDL_Color Colors::YELLOW = { 229, 215, 123, 0 };
 const SDL_Color Colors::WHITE = { 255, 243, 222, 0 };
 const SDL_Color Colors::METALLIC_GOLD = { 173, 142, 66, 0 };
@@ -303,6 +308,12 @@ int CSDL_Ext::blit8bppAlphaTo24bppT(const SDL_Surface * src, const SDL_Rect * sr
 
 			for(int y=h; y; y--, colory+=src->pitch, py+=dst->pitch)
 			{
+				if(bpp == 4)
+				{
+					blitPaletteRow4bpp(colors, colory, py, w);
+					continue;
+				}
+
 				Uint8 *color = colory;
 				Uint8 *p = py;
 
@@ -331,6 +342,61 @@ int CSDL_Ext::blit8bppAlphaTo24bpp(const SDL_Surface * src, const SDL_Rect * src
 	}
 }
 
+void CSDL_Ext::blitPaletteRow4bpp(const SDL_Color * colors, const Uint8 * src, Uint8 * dst, int count)
+{
+	int x = 0;
+#ifdef VCMI_BLIT_SSE2
+	//SSE2 is x86-only, so screen pixel layout is always BGRA here, see Channels::px<4>
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i fullAlpha = _mm_set1_epi32(255);
+	const __m128i alphaChannel = _mm_set1_epi32(0xFF000000);
+	const __m128i lowByte = _mm_set1_epi16(0x00FF);
+
+	for(; x + 4 <= count; x += 4)
+	{
+		Uint32 gathered[4]; //palette lookup has no vector form in SSE2
+		for(int i = 0; i < 4; i++)
+			memcpy(&gathered[i], &colors[src[x + i]], sizeof(Uint32));
+
+		const __m128i srcPx = _mm_loadu_si128(reinterpret_cast<const __m128i *>(gathered));
+		const __m128i alpha = _mm_srli_epi32(srcPx, 24);
+		const __m128i transparent = _mm_cmpeq_epi32(alpha, zero);
+
+		if(_mm_movemask_epi8(transparent) == 0xFFFF)
+			continue;
+
+		const __m128i opaque = _mm_cmpeq_epi32(alpha, fullAlpha);
+		__m128i * const dstPtr = reinterpret_cast<__m128i *>(dst + x * 4);
+		const __m128i dstPx = _mm_loadu_si128(dstPtr);
+
+		//widen to 16 bit per channel and reorder RGBA palette entries to BGRA
+		const __m128i srcLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(_mm_unpacklo_epi8(srcPx, zero), _MM_SHUFFLE(3, 0, 1, 2)), _MM_SHUFFLE(3, 0, 1, 2));
+		const __m128i srcHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(_mm_unpackhi_epi8(srcPx, zero), _MM_SHUFFLE(3, 0, 1, 2)), _MM_SHUFFLE(3, 0, 1, 2));
+		const __m128i dstLo = _mm_unpacklo_epi8(dstPx, zero);
+		const __m128i dstHi = _mm_unpackhi_epi8(dstPx, zero);
+		const __m128i alphaLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(srcLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128i alphaHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(srcHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+		//dst + ((src - dst) * alpha >> 8), truncated to 8 bits exactly like ColorPutter::PutColor does
+		const __m128i blendLo = _mm_and_si128(_mm_add_epi16(dstLo, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(srcLo, dstLo), alphaLo), 8)), lowByte);
+		const __m128i blendHi = _mm_and_si128(_mm_add_epi16(dstHi, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(srcHi, dstHi), alphaHi), 8)), lowByte);
+
+		__m128i result = _mm_packus_epi16(blendLo, blendHi);
+		result = _mm_or_si128(_mm_and_si128(opaque, _mm_packus_epi16(srcLo, srcHi)), _mm_andnot_si128(opaque, result));
+		result = _mm_or_si128(result, alphaChannel);
+		result = _mm_or_si128(_mm_and_si128(transparent, dstPx), _mm_andnot_si128(transparent, result));
+
+		_mm_storeu_si128(dstPtr, result);
+	}
+#endif
+	Uint8 * p = dst + x * 4;
+	for(; x < count; x++)
+	{
+		const SDL_Color & tbc = colors[src[x]];
+		ColorPutter<4, +1>::PutColorAlphaSwitch(p, tbc.r, tbc.g, tbc.b, tbc.a);
+	}
+}
+
 Uint32 CSDL_Ext::colorToUint32(const SDL_Color * color)
 {
 	Uint32 ret = 0;
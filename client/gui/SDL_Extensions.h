@@ -189,6 +189,7 @@ namespace CSDL_Ext
 	template<int bpp>
 	int blit8bppAlphaTo24bppT(const SDL_Surface * src, const SDL_Rect * srcRect, SDL_Surface * dst, SDL_Rect * dstRect); //blits 8 bpp surface with alpha channel to 24 bpp surface
 	int blit8bppAlphaTo24bpp(const SDL_Surface * src, const SDL_Rect * srcRect, SDL_Surface * dst, SDL_Rect * dstRect); //blits 8 bpp surface with alpha channel to 24 bpp surface
+	void blitPaletteRow4bpp(const SDL_Color * colors, const Uint8 * src, Uint8 * dst, int count); //blits row of 8 bpp pixels with alpha channel to 32 bpp surface, vectorized where possible
 	Uint32 colorToUint32(const SDL_Color * color); //little endian only
 	SDL_Color makeColor(ui8 r, ui8 g, ui8 b, ui8 a);
 
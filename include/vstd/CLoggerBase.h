@@ -62,9 +62,16 @@ public:
 	virtual bool isDebugEnabled() const = 0;
 	virtual bool isTraceEnabled() const = 0;
 
+	/// Returns true if message of specified level will be logged
+	virtual bool isEnabledFor(ELogLevel::ELogLevel level) const = 0;
+
 	template<typename T, typename ... Args>
 	void log(ELogLevel::ELogLevel level, const std::string & format, T t, Args ... args) const
 	{
+		// don't spend time on formatting messages that will be discarded anyway
+		if(!isEnabledFor(level))
+			return;
+
 		try
 		{
 			boost::format fmt(format);
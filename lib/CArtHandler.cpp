@@ -330,7 +330,7 @@ CArtifact * CArtHandler::loadFromJson(const JsonNode & node, const std::string &
 	loadType(art, node);
 	loadComponents(art, node);
 
-	for (auto b : node["bonuses"].Vector())
+	for (auto & b : node["bonuses"].Vector())
 	{
 		auto bonus = JsonUtils::parseBonus(b);
 		art->addNewBonus(bonus);
@@ -1771,7 +1771,7 @@ void CGameState::initMapObjects()
 	}
 	CGSubterraneanGate::postInit(); //pairing subterranean gates
 
-	map->calculateGuardingGreaturePositions(); //calculate once again when all the guards are placed and initialized
+	map->calculateGuardingGreaturePositions(true); //calculate once again when all the guards are placed and initialized
 }
 
 void CGameState::initVisitingAndGarrisonedHeroes()
@@ -24,6 +24,8 @@
 #include "IHandlerBase.h"
 #include "spells/CSpellHandler.h"
 #include "CSkillHandler.h"
+#include "CThreadHelper.h"
+#include "VCMIDirs.h"
 
 CIdentifierStorage::CIdentifierStorage():
 	state(LOADING)
@@ -335,7 +337,7 @@ bool CContentHandler::ContentTypeHandler::preloadModData(std::string modName, st
 
 	ModInfo & modInfo = modData[modName];
 
-	for(auto entry : data.Struct())
+	for(auto & entry : data.Struct())
 	{
 		size_t colon = entry.first.find(':');
 
@@ -875,7 +877,106 @@ static ISimpleResourceLoader * genModFilesystem(const std::string & modName, con
 		return CResourceHandler::createFileSystem(CModInfo::getModDir(modName), defaultFS);
 }
 
-static ui32 calculateModChecksum(const std::string modName, ISimpleResourceLoader * filesystem)
+/// Remembers checksums of mod files between runs, file is read again only if its size or modification time has changed
+class CModFileChecksumCache : public boost::noncopyable
+{
+	boost::filesystem::path cacheFile;
+	JsonNode entries;
+	std::set<std::string> usedEntries;
+	boost::mutex mx;
+	bool changed;
+
+public:
+	CModFileChecksumCache():
+		cacheFile(VCMIDirs::get().userCachePath() / "modChecksums.json"),
+		changed(false)
+	{
+		try
+		{
+			if(boost::filesystem::exists(cacheFile))
+			{
+				std::ifstream in(cacheFile.string(), std::ios::binary);
+				std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+				entries = JsonNode(data.c_str(), data.size());
+				if(entries.getType() != JsonNode::JsonType::DATA_STRUCT)
+					entries.clear();
+			}
+		}
+		catch(const std::exception & e)
+		{
+			logMod->warn("Failed to load mod checksum cache: %s", e.what());
+			entries.clear();
+		}
+	}
+
+	ui32 getChecksum(ISimpleResourceLoader * filesystem, const ResourceID & file)
+	{
+		auto path = filesystem->getResourceName(file);
+		if(!path) // e.g. file from archive
+			return filesystem->load(file)->calculateCRC32();
+
+		// this is called from worker threads, so filesystem errors must not throw
+		boost::system::error_code sizeError, timeError;
+		const si64 size = boost::filesystem::file_size(*path, sizeError);
+		const si64 modified = boost::filesystem::last_write_time(*path, timeError);
+		if(sizeError || timeError)
+		{
+			logMod->warn("Failed to query %s, checksum will not be cached: %s", path->string(), (sizeError ? sizeError : timeError).message());
+			return filesystem->load(file)->calculateCRC32();
+		}
+
+		const std::string key = path->string();
+		{
+			TLockGuard _(mx);
+			usedEntries.insert(key);
+			const JsonNode & entry = static_cast<const JsonNode &>(entries)[key];
+			if(!entry.isNull() && entry["size"].Integer() == size && entry["modified"].Integer() == modified)
+				return entry["checksum"].Integer();
+		}
+
+		ui32 checksum = filesystem->load(file)->calculateCRC32();
+
+		TLockGuard _(mx);
+		JsonNode & entry = entries[key];
+		entry["size"].Integer() = size;
+		entry["modified"].Integer() = modified;
+		entry["checksum"].Integer() = checksum;
+		changed = true;
+		return checksum;
+	}
+
+	/// Saves cache to disk. Entries that were not requested during this run (e.g. removed files) are dropped
+	void save()
+	{
+		auto & files = entries.Struct();
+		for(auto it = files.begin(); it != files.end();)
+		{
+			if(vstd::contains(usedEntries, it->first))
+			{
+				++it;
+			}
+			else
+			{
+				it = files.erase(it);
+				changed = true;
+			}
+		}
+
+		if(!changed)
+			return;
+		try
+		{
+			std::ofstream out(cacheFile.string(), std::ios::binary | std::ios::trunc);
+			out << entries.toJson();
+		}
+		catch(const std::exception & e)
+		{
+			logMod->warn("Failed to save mod checksum cache: %s", e.what());
+		}
+	}
+};
+
+static ui32 calculateModChecksum(const std::string modName, ISimpleResourceLoader * filesystem, CModFileChecksumCache & cache)
 {
 	boost::crc_32_type modChecksum;
 	// first - add current VCMI version into checksum to force re-validation on VCMI updates
@@ -886,7 +987,7 @@ static ui32 calculateModChecksum(const std::string modName, ISimpleResourceLoade
 	if (modName != "core")
 	{
 		ResourceID modConfFile(CModInfo::getModFile(modName), EResType::TEXT);
-		ui32 configChecksum = CResourceHandler::get("initial")->load(modConfFile)->calculateCRC32();
+		ui32 configChecksum = cache.getChecksum(CResourceHandler::get("initial"), modConfFile);
 		modChecksum.process_bytes(reinterpret_cast<const void *>(&configChecksum), sizeof(configChecksum));
 	}
 	// third - add all detected text files from this mod into checksum
@@ -899,7 +1000,7 @@ static ui32 calculateModChecksum(const std::string modName, ISimpleResourceLoade
 
 	for (const ResourceID & file : files)
 	{
-		ui32 fileChecksum = filesystem->load(file)->calculateCRC32();
+		ui32 fileChecksum = cache.getChecksum(filesystem, file);
 		modChecksum.process_bytes(reinterpret_cast<const void *>(&fileChecksum), sizeof(fileChecksum));
 	}
 	return modChecksum.checksum();
@@ -909,8 +1010,6 @@ void CModHandler::loadModFilesystems()
 {
 	activeMods = resolveDependencies(activeMods);
 
-	coreMod.updateChecksum(calculateModChecksum("core", CResourceHandler::get("core")));
-
 	for(std::string & modName : activeMods)
 	{
 		CModInfo & mod = allMods[modName];
@@ -944,11 +1043,37 @@ void CModHandler::load()
 	CContentHandler content;
 	logMod->info("\tInitializing content handler: %d ms", timer.getDiff());
 
-	for(const TModID & modName : activeMods)
+	// mods are independent from each other, so their checksums can be generated in parallel
+	// core mod is checksummed here as well so all mods share single cache
 	{
-		logMod->trace("Generating checksum for %s", modName);
-		allMods[modName].updateChecksum(calculateModChecksum(modName, CResourceHandler::get(modName)));
+		CModFileChecksumCache checksumCache;
+		std::vector<TModID> modNames(activeMods);
+		modNames.insert(modNames.begin(), "core");
+
+		std::vector<ui32> checksums(modNames.size());
+		std::vector<Task> tasks;
+		for(size_t i = 0; i < modNames.size(); i++)
+		{
+			const TModID & modName = modNames[i];
+			ISimpleResourceLoader * filesystem = CResourceHandler::get(modName);
+			ui32 * checksum = &checksums[i];
+			tasks.push_back([=, &checksumCache]()
+			{
+				const auto start = boost::posix_time::microsec_clock::universal_time();
+				*checksum = calculateModChecksum(modName, filesystem, checksumCache);
+				const auto duration = boost::posix_time::microsec_clock::universal_time() - start;
+				logMod->debug("Generated checksum for %s: %d ms", modName, duration.total_milliseconds());
+			});
+		}
+		CThreadHelper helper(&tasks, std::max<int>(1, std::min<int>(boost::thread::hardware_concurrency(), tasks.size())));
+		helper.run();
+
+		coreMod.updateChecksum(checksums[0]);
+		for(size_t i = 0; i < activeMods.size(); i++)
+			allMods[activeMods[i]].updateChecksum(checksums[i + 1]);
+		checksumCache.save();
 	}
+	logMod->info("\tGenerating mod checksums: %d ms", timer.getDiff());
 
 	// first - load virtual "core" mod that contains all data
 	// TODO? move all data into real mods? RoE, AB, SoD, WoG
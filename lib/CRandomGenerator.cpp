@@ -37,12 +37,12 @@ TRandI CRandomGenerator::getIntRange(int lower, int upper)
 
 int CRandomGenerator::nextInt(int upper)
 {
-	return getIntRange(0, upper)();
+	return TIntDist(0, upper)(rand);
 }
 
 int CRandomGenerator::nextInt(int lower, int upper)
 {
-	return getIntRange(lower, upper)();
+	return TIntDist(lower, upper)(rand);
 }
 
 int CRandomGenerator::nextInt()
@@ -57,12 +57,12 @@ TRand CRandomGenerator::getDoubleRange(double lower, double upper)
 
 double CRandomGenerator::nextDouble(double upper)
 {
-	return getDoubleRange(0, upper)();
+	return TRealDist(0, upper)(rand);
 }
 
 double CRandomGenerator::nextDouble(double lower, double upper)
 {
-	return getDoubleRange(lower, upper)();
+	return TRealDist(lower, upper)(rand);
 }
 
 double CRandomGenerator::nextDouble()
@@ -62,6 +62,20 @@ public:
 	/// Generates a double between 0.0 and 1.0.
 	double nextDouble();
 
+	/// Fills [first, last) with integers within the same range. Draws exactly the same
+	/// numbers as calling nextInt(lower, upper) once per element.
+	/// requires: lower <= upper
+	template<typename OutputIt>
+	void fillIntRange(OutputIt first, OutputIt last, int lower, int upper)
+	{
+		TIntDist dist(lower, upper);
+		for(; first != last; ++first)
+		{
+			dist.reset();
+			*first = dist(rand);
+		}
+	}
+
 	/// Gets a globally accessible RNG which will be constructed once per thread. For the
 	/// seed a combination of the thread ID and current time in milliseconds will be used.
 	static CRandomGenerator & getDefault();
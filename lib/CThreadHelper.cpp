@@ -24,14 +24,18 @@ CThreadHelper::CThreadHelper(std::vector<std::function<void()> > *Tasks, int Thr
 }
 void CThreadHelper::run()
 {
+	// not worth starting threads for a single task
+	if(threads < 2 || amount < 2)
+	{
+		processTasks();
+		return;
+	}
+
+	// thread_group owns and deletes created threads
 	boost::thread_group grupa;
-	std::vector<boost::thread *> thr;
-	for(int i=0;i<threads;i++)
-		thr.push_back(grupa.create_thread(std::bind(&CThreadHelper::processTasks,this)));
+	for(int i=0;i<std::min(threads, amount);i++)
+		grupa.create_thread(std::bind(&CThreadHelper::processTasks,this));
 	grupa.join_all();
-
-	for(auto thread : thr)
-		delete thread;
 }
 void CThreadHelper::processTasks()
 {
@@ -376,13 +376,14 @@ bool JsonParser::extractStruct(JsonNode &node)
 		if (!extractString(key))
 			return false;
 
-		if (node.Struct().find(key) != node.Struct().end())
+		auto inserted = node.Struct().insert(std::make_pair(std::move(key), JsonNode()));
+		if (!inserted.second)
 			error("Dublicated element encountered!", true);
 
 		if (!extractSeparator())
 			return false;
 
-		if (!extractElement(node.Struct()[key], '}'))
+		if (!extractElement(inserted.first->second, '}'))
 			return false;
 
 		if (input[pos] == '}')
@@ -410,8 +411,6 @@ bool JsonParser::extractArray(JsonNode &node)
 
 	while (true)
 	{
-		//NOTE: currently 50% of time is this vector resizing.
-		//May be useful to use list during parsing and then swap() all items to vector
 		node.Vector().resize(node.Vector().size()+1);
 
 		if (!extractElement(node.Vector().back(), ']'))
@@ -690,7 +689,7 @@ namespace
 
 		std::string formatCheck(Validation::ValidationData & validator, const JsonNode & baseSchema, const JsonNode & schema, const JsonNode & data)
 		{
-			auto formats = Validation::getKnownFormats();
+			const auto & formats = Validation::getKnownFormats();
 			std::string errors;
 			auto checker = formats.find(schema.String());
 			if (checker != formats.end())
@@ -766,7 +765,7 @@ namespace
 
 	namespace Vector
 	{
-		std::string itemEntryCheck(Validation::ValidationData & validator, const JsonVector items, const JsonNode & schema, size_t index)
+		std::string itemEntryCheck(Validation::ValidationData & validator, const JsonVector & items, const JsonNode & schema, size_t index)
 		{
 			validator.currentPath.push_back(JsonNode());
 			validator.currentPath.back().Float() = index;
@@ -898,8 +897,7 @@ namespace
 				{
 					if (deps.second.getType() == JsonNode::JsonType::DATA_VECTOR)
 					{
-						JsonVector depList = deps.second.Vector();
-						for(auto & depEntry : depList)
+						for(auto & depEntry : deps.second.Vector())
 						{
 							if (data[depEntry.String()].isNull())
 								errors += validator.makeErrorMessage("Property " + depEntry.String() + " required for " + deps.first + " is missing");
@@ -1121,10 +1119,93 @@ namespace
 
 		return ret;
 	}
+
+	/// Schema node with its fields already matched to validators for every type of data
+	struct CompiledSchema
+	{
+		typedef std::vector<std::pair<const Validation::TFieldValidator *, const JsonNode *>> TFieldList;
+
+		TFieldList commonFields;
+		TFieldList numberFields;
+		TFieldList stringFields;
+		TFieldList vectorFields;
+		TFieldList structFields;
+
+		const TFieldList & getFieldsFor(JsonNode::JsonType type) const
+		{
+			switch (type)
+			{
+				case JsonNode::JsonType::DATA_FLOAT:
+				case JsonNode::JsonType::DATA_INTEGER:
+					return numberFields;
+				case JsonNode::JsonType::DATA_STRING: return stringFields;
+				case JsonNode::JsonType::DATA_VECTOR: return vectorFields;
+				case JsonNode::JsonType::DATA_STRUCT: return structFields;
+				default: return commonFields;
+			}
+		}
+	};
+
+	void compileFields(CompiledSchema::TFieldList & fields, const JsonNode & schema, JsonNode::JsonType type)
+	{
+		const Validation::TValidatorMap & knownFields = Validation::getKnownFieldsFor(type);
+		for(auto & entry : schema.Struct())
+		{
+			auto checker = knownFields.find(entry.first);
+			if (checker != knownFields.end())
+				fields.push_back(std::make_pair(&checker->second, &entry.second));
+		}
+	}
+
+	/// guards compiled and resolved schemas, validation may run from several threads
+	static boost::mutex schemaCacheMutex;
+
+	/// Schemas are grouped by URI of schema file they belong to. Schema files are loaded once by JsonUtils::getSchema
+	/// and are never unloaded, so nodes inside of them can be identified by address
+	const CompiledSchema & getCompiledSchema(const std::string & schemaURI, const JsonNode & schema)
+	{
+		static std::unordered_map<std::string, std::unordered_map<const JsonNode *, CompiledSchema>> compiledSchemas;
+
+		const std::string schemaFile = schemaURI.substr(0, schemaURI.find('#'));
+
+		TLockGuard _(schemaCacheMutex);
+		auto & fileSchemas = compiledSchemas[schemaFile];
+		auto it = fileSchemas.find(&schema);
+		if (it != fileSchemas.end())
+			return it->second;
+
+		CompiledSchema & compiled = fileSchemas[&schema];
+		compileFields(compiled.commonFields, schema, JsonNode::JsonType::DATA_NULL);
+		compileFields(compiled.numberFields, schema, JsonNode::JsonType::DATA_FLOAT);
+		compileFields(compiled.stringFields, schema, JsonNode::JsonType::DATA_STRING);
+		compileFields(compiled.vectorFields, schema, JsonNode::JsonType::DATA_VECTOR);
+		compileFields(compiled.structFields, schema, JsonNode::JsonType::DATA_STRUCT);
+		return compiled;
+	}
+
+	/// resolves schema references, parsing each URI only once
+	const JsonNode & getSchemaByURI(const std::string & URI)
+	{
+		static std::unordered_map<std::string, const JsonNode *> resolvedSchemas;
+
+		TLockGuard _(schemaCacheMutex);
+		auto it = resolvedSchemas.find(URI);
+		if (it != resolvedSchemas.end())
+			return *it->second;
+
+		const JsonNode & schema = JsonUtils::getSchema(URI);
+		resolvedSchemas[URI] = &schema;
+		return schema;
+	}
 }
 
 namespace Validation
 {
+	ValidationData::ValidationData():
+		persistentSchema(false)
+	{
+	}
+
 	std::string ValidationData::makeErrorMessage(const std::string &message)
 	{
 		std::string errors;
@@ -1154,18 +1235,28 @@ namespace Validation
 
 	std::string check(std::string schemaName, const JsonNode & data, ValidationData & validator)
 	{
+		const bool wasPersistent = validator.persistentSchema;
 		validator.usedSchemas.push_back(schemaName);
+		validator.persistentSchema = true;
 		auto onscopeExit = vstd::makeScopeGuard([&]()
 		{
 			validator.usedSchemas.pop_back();
+			validator.persistentSchema = wasPersistent;
 		});
-		return check(JsonUtils::getSchema(schemaName), data, validator);
+		return check(getSchemaByURI(schemaName), data, validator);
 	}
 
 	std::string check(const JsonNode & schema, const JsonNode & data, ValidationData & validator)
 	{
-		const TValidatorMap & knownFields = getKnownFieldsFor(data.getType());
 		std::string errors;
+		if (validator.persistentSchema)
+		{
+			for(auto & field : getCompiledSchema(validator.usedSchemas.back(), schema).getFieldsFor(data.getType()))
+				errors += (*field.first)(validator, schema, *field.second, data);
+			return errors;
+		}
+
+		const TValidatorMap & knownFields = getKnownFieldsFor(data.getType());
 		for(auto & entry : schema.Struct())
 		{
 			auto checker = knownFields.find(entry.first);
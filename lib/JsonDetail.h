@@ -106,6 +106,12 @@ namespace Validation
 		/// May contain multiple items in case if remote references were found
 		std::vector<std::string> usedSchemas;
 
+		/// true if schema currently in use is loaded via JsonUtils::getSchema and will never be destroyed
+		/// such schemas are matched with validators only once
+		bool persistentSchema;
+
+		ValidationData();
+
 		/// generates error message
 		std::string makeErrorMessage(const std::string &message);
 	};
@@ -85,6 +85,13 @@ JsonNode::JsonNode(const JsonNode &copy):
 	}
 }
 
+JsonNode::JsonNode(JsonNode &&other) noexcept:
+	type(JsonType::DATA_NULL),
+	data()
+{
+	swap(other);
+}
+
 JsonNode::~JsonNode()
 {
 	setType(JsonType::DATA_NULL);
@@ -315,12 +322,12 @@ const JsonMap & JsonNode::Struct() const
 	return *data.Struct;
 }
 
-JsonNode & JsonNode::operator[](std::string child)
+JsonNode & JsonNode::operator[](const std::string & child)
 {
 	return Struct()[child];
 }
 
-const JsonNode & JsonNode::operator[](std::string child) const
+const JsonNode & JsonNode::operator[](const std::string & child) const
 {
 	auto it = Struct().find(child);
 	if (it != Struct().end())
@@ -649,19 +656,19 @@ void minimizeNode(JsonNode & node, const JsonNode & schema)
 	if (schema["type"].String() == "object")
 	{
 		std::set<std::string> foundEntries;
+		const JsonNode & properties = schema["properties"];
 
 		for(auto & entry : schema["required"].Vector())
 		{
-			std::string name = entry.String();
+			const std::string & name = entry.String();
+			const JsonNode & propertySchema = properties[name];
 			foundEntries.insert(name);
 
-			minimizeNode(node[name], schema["properties"][name]);
+			JsonNode & value = node[name];
+			minimizeNode(value, propertySchema);
 
-			if (vstd::contains(node.Struct(), name) &&
-				node[name] == schema["properties"][name]["default"])
-			{
+			if (value == propertySchema["default"])
 				node.Struct().erase(name);
-			}
 		}
 
 		// erase all unhandled entries
@@ -687,19 +694,20 @@ void maximizeNode(JsonNode & node, const JsonNode & schema)
 	if (schema["type"].String() == "object")
 	{
 		std::set<std::string> foundEntries;
+		const JsonNode & properties = schema["properties"];
 
 		// check all required entries that have default version
 		for(auto & entry : schema["required"].Vector())
 		{
-			std::string name = entry.String();
+			const std::string & name = entry.String();
+			const JsonNode & propertySchema = properties[name];
 			foundEntries.insert(name);
 
-			if (node[name].isNull() &&
-				!schema["properties"][name]["default"].isNull())
-			{
-				node[name] = schema["properties"][name]["default"];
-			}
-			maximizeNode(node[name], schema["properties"][name]);
+			JsonNode & value = node[name];
+			if (value.isNull() && !propertySchema["default"].isNull())
+				value = propertySchema["default"];
+
+			maximizeNode(value, propertySchema);
 		}
 
 		// erase all unhandled entries
@@ -732,8 +740,11 @@ bool JsonUtils::validate(const JsonNode &node, std::string schemaName, std::stri
 const JsonNode & getSchemaByName(std::string name)
 {
 	// cached schemas to avoid loading json data multiple times
+	// schemas are never removed, so returned references stay valid
 	static std::map<std::string, JsonNode> loadedSchemas;
+	static boost::mutex loadedSchemasMutex;
 
+	TLockGuard _(loadedSchemasMutex);
 	if (vstd::contains(loadedSchemas, name))
 		return loadedSchemas[name];
 
@@ -780,7 +791,7 @@ void JsonUtils::merge(JsonNode & dest, JsonNode & source)
 {
 	if (dest.getType() == JsonNode::JsonType::DATA_NULL)
 	{
-		std::swap(dest, source);
+		dest.swap(source);
 		return;
 	}
 
@@ -797,7 +808,7 @@ void JsonUtils::merge(JsonNode & dest, JsonNode & source)
 		case JsonNode::JsonType::DATA_STRING:
 		case JsonNode::JsonType::DATA_VECTOR:
 		{
-			std::swap(dest, source);
+			dest.swap(source);
 			break;
 		}
 		case JsonNode::JsonType::DATA_STRUCT:
@@ -58,6 +58,8 @@ public:
 	explicit JsonNode(ResourceID && fileURI, bool & isValidSyntax);
 	//Copy c-tor
 	JsonNode(const JsonNode &copy);
+	//Move c-tor, noexcept lets containers move nodes on reallocation instead of copying whole subtrees
+	JsonNode(JsonNode &&other) noexcept;
 
 	~JsonNode();
 
@@ -107,8 +109,8 @@ public:
 	Type convertTo() const;
 
 	//operator [], for structs only - get child node by name
-	JsonNode & operator[](std::string child);
-	const JsonNode & operator[](std::string child) const;
+	JsonNode & operator[](const std::string & child);
+	const JsonNode & operator[](const std::string & child) const;
 
 	std::string toJson() const;
 
@@ -2021,6 +2021,33 @@ struct MoveHero : public CPackForServer
 	}
 };
 
+struct MoveHeroPath : public CPackForServer
+{
+	struct Step
+	{
+		int3 dest;
+		bool transit;
+
+		template <typename Handler> void serialize(Handler &h, const int version)
+		{
+			h & dest;
+			h & transit;
+		}
+	};
+
+	MoveHeroPath(){};
+	MoveHeroPath(ObjectInstanceID HID) : hid(HID) {};
+	ObjectInstanceID hid;
+	std::vector<Step> steps; //in order of movement, each step is same as in MoveHero
+
+	bool applyGh(CGameHandler *gh);
+	template <typename Handler> void serialize(Handler &h, const int version)
+	{
+		h & hid;
+		h & steps;
+	}
+};
+
 struct CastleTeleportHero : public CPackForServer
 {
 	CastleTeleportHero():source(0){};
@@ -93,10 +93,13 @@ ui32 BattleInfo::calculateDmg(const CStack * attacker, const CStack * defender,
 
 	if(range.first != range.second)
 	{
+		std::array<int, 10> rolls;
+		ui32 howManyToAv = std::min<ui32>(rolls.size(), attacker->getCount());
+		rand.fillIntRange(rolls.begin(), rolls.begin() + howManyToAv, range.first, range.second);
+
 		ui32 sum = 0;
-		ui32 howManyToAv = std::min<ui32>(10, attacker->getCount());
-		for(int g=0; g<howManyToAv; ++g)
-			sum += (ui32)rand.nextInt(range.first, range.second);
+		for(ui32 g=0; g<howManyToAv; ++g)
+			sum += (ui32)rolls[g];
 
 		return sum / howManyToAv;
 	}
@@ -557,12 +557,12 @@ bool CBattleInfoCallback::battleCanShoot(const CStack * stack, BattleHex dest) c
 	return false;
 }
 
-TDmgRange CBattleInfoCallback::calculateDmgRange(const BattleAttackInfo & info) const
+AttackerDamageStats::AttackerDamageStats(const IBonusBearer * bearer, bool shooting)
 {
-	auto battleBonusValue = [&](const IBonusBearer * bearer, CSelector selector) -> int
+	auto battleBonusValue = [&](CSelector selector) -> int
 	{
 		auto noLimit = Selector::effectRange(Bonus::NO_LIMIT);
-		auto limitMatches = info.shooting
+		auto limitMatches = shooting
 							? Selector::effectRange(Bonus::ONLY_DISTANCE_FIGHT)
 							: Selector::effectRange(Bonus::ONLY_MELEE_FIGHT);
 
@@ -570,9 +570,100 @@ TDmgRange CBattleInfoCallback::calculateDmgRange(const BattleAttackInfo & info)
 		return bearer->getBonuses(selector, noLimit.Or(limitMatches))->totalValue();
 	};
 
+	minDamage = bearer->getMinDamage();
+	maxDamage = bearer->getMaxDamage();
+
+	siegeWeapon = bearer->hasBonusOfType(Bonus::SIEGE_WEAPON);
+	heroAttack = 0;
+	if(siegeWeapon)
+	{
+		const std::shared_ptr<Bonus> b = bearer->getBonus(Selector::sourceTypeSel(Bonus::HERO_BASE_SKILL).And(Selector::typeSubtype(Bonus::PRIMARY_SKILL, PrimarySkill::ATTACK)));
+		heroAttack = b ? b->val : 0; //if there is no hero or no info on his primary skill, use 0
+	}
+
+	multAttackReduction = (100 - battleBonusValue(Selector::type(Bonus::GENERAL_ATTACK_REDUCTION))) / 100.0;
+	attack = battleBonusValue(Selector::typeSubtype(Bonus::PRIMARY_SKILL, PrimarySkill::ATTACK));
+	multDefenceReduction = (100 - battleBonusValue(Selector::type(Bonus::ENEMY_DEFENCE_REDUCTION))) / 100.0;
+
+	const std::shared_ptr<Bonus> slayerEffect = bearer->getBonus(Selector::type(Bonus::SLAYER)); //TODO: apply only ONLY_MELEE_FIGHT / DISTANCE_FIGHT?
+	slayerLevel = slayerEffect ? slayerEffect->val : -1;
+
+	jousting = bearer->hasBonusOfType(Bonus::JOUSTING);
+	skillPremy = bearer->valOfBonuses(Bonus::SECONDARY_SKILL_PREMY, shooting ? SecondarySkill::ARCHERY : SecondarySkill::OFFENCE);
+
+	forgetful = false;
+	forgetfulLevel = 0;
+	if(shooting)
+	{
+		//get list first, total value of 0 also counts
+		TBonusListPtr forgetfulList = bearer->getBonuses(Selector::type(Bonus::FORGETFULL),"");
+		forgetful = !forgetfulList->empty();
+		if(forgetful)
+			forgetfulLevel = forgetfulList->valOfBonuses(Selector::type(Bonus::FORGETFULL));
+	}
+
+	TBonusListPtr curseEffects = bearer->getBonuses(Selector::type(Bonus::ALWAYS_MINIMUM_DAMAGE));
+	TBonusListPtr blessEffects = bearer->getBonuses(Selector::type(Bonus::ALWAYS_MAXIMUM_DAMAGE));
+	cursed = !curseEffects->empty();
+	blessed = !blessEffects->empty();
+	curseBlessAdditiveModifier = blessEffects->totalValue() - curseEffects->totalValue();
+	curseMultiplicativePenalty = cursed ? (*std::max_element(curseEffects->begin(), curseEffects->end(), &Bonus::compareByAdditionalInfo<std::shared_ptr<Bonus>>))->additionalInfo : 0;
+
+	noDistancePenalty = bearer->hasBonusOfType(Bonus::NO_DISTANCE_PENALTY);
+	meleePenalty = !shooting && bearer->hasBonusOfType(Bonus::SHOOTER) && !bearer->hasBonusOfType(Bonus::NO_MELEE_PENALTY);
+}
+
+DefenderDamageStats::DefenderDamageStats(const IBonusBearer * bearer, bool shooting)
+{
+	auto isAdvancedAirShield = [](const Bonus* bonus)
+	{
+		return bonus->source == Bonus::SPELL_EFFECT
+				&& bonus->sid == SpellID::AIR_SHIELD
+				&& bonus->val >= SecSkillLevel::ADVANCED;
+	};
+
+	defence = bearer->Defense();
+	chargeImmunity = bearer->hasBonusOfType(Bonus::CHARGE_IMMUNITY);
+	mindImmunity = bearer->hasBonusOfType(Bonus::MIND_IMMUNITY);
+	advancedAirShield = shooting && bearer->hasBonus(isAdvancedAirShield);
+	armorerMultiplier = (std::max(0, 100 - bearer->valOfBonuses(Bonus::SECONDARY_SKILL_PREMY, SecondarySkill::ARMORER))) / 100.0;
+	//eg. shield or air shield
+	damageReductionMultiplier = (100 - bearer->valOfBonuses(Bonus::GENERAL_DAMAGE_REDUCTION, shooting ? 1 : 0)) / 100.0;
+}
+
+const AttackerDamageStats & DamageStatsCache::getAttackerStats(const IBonusBearer * bearer, bool shooting)
+{
+	auto key = std::make_pair(bearer, shooting);
+	auto it = attackers.find(key);
+	if(it == attackers.end())
+		it = attackers.insert(std::make_pair(key, AttackerDamageStats(bearer, shooting))).first;
+	return it->second;
+}
+
+const DefenderDamageStats & DamageStatsCache::getDefenderStats(const IBonusBearer * bearer, bool shooting)
+{
+	auto key = std::make_pair(bearer, shooting);
+	auto it = defenders.find(key);
+	if(it == defenders.end())
+		it = defenders.insert(std::make_pair(key, DefenderDamageStats(bearer, shooting))).first;
+	return it->second;
+}
+
+TDmgRange CBattleInfoCallback::calculateDmgRange(const BattleAttackInfo & info) const
+{
+	return calculateDmgRange(info, AttackerDamageStats(info.attackerBonuses, info.shooting), DefenderDamageStats(info.defenderBonuses, info.shooting));
+}
+
+TDmgRange CBattleInfoCallback::calculateDmgRange(const BattleAttackInfo & info, DamageStatsCache & cache) const
+{
+	return calculateDmgRange(info, cache.getAttackerStats(info.attackerBonuses, info.shooting), cache.getDefenderStats(info.defenderBonuses, info.shooting));
+}
+
+TDmgRange CBattleInfoCallback::calculateDmgRange(const BattleAttackInfo & info, const AttackerDamageStats & attackerStats, const DefenderDamageStats & defenderStats) const
+{
 	double additiveBonus = 1.0, multBonus = 1.0,
-			minDmg = info.attackerBonuses->getMinDamage() * info.attackerHealth.getCount(),//TODO: ONLY_MELEE_FIGHT / ONLY_DISTANCE_FIGHT
-			maxDmg = info.attackerBonuses->getMaxDamage() * info.attackerHealth.getCount();
+			minDmg = attackerStats.minDamage * info.attackerHealth.getCount(),//TODO: ONLY_MELEE_FIGHT / ONLY_DISTANCE_FIGHT
+			maxDmg = attackerStats.maxDamage * info.attackerHealth.getCount();
 
 	const CCreature *attackerType = info.attacker->getCreature(),
 			*defenderType = info.defender->getCreature();
@@ -584,50 +675,26 @@ TDmgRange CBattleInfoCallback::calculateDmgRange(const BattleAttackInfo & info)
 		return unmodifiableTowerDamage;
 	}
 
-	if(info.attackerBonuses->hasBonusOfType(Bonus::SIEGE_WEAPON) && attackerType->idNumber != CreatureID::ARROW_TOWERS) //any siege weapon, but only ballista can attack (second condition - not arrow turret)
+	if(attackerStats.siegeWeapon) //any siege weapon, but only ballista can attack (arrow turrets are handled above)
 	{ //minDmg and maxDmg are multiplied by hero attack + 1
-		auto retreiveHeroPrimSkill = [&](int skill) -> int
-		{
-			const std::shared_ptr<Bonus> b = info.attackerBonuses->getBonus(Selector::sourceTypeSel(Bonus::HERO_BASE_SKILL).And(Selector::typeSubtype(Bonus::PRIMARY_SKILL, skill)));
-			return b ? b->val : 0; //if there is no hero or no info on his primary skill, return 0
-		};
-
-
-		minDmg *= retreiveHeroPrimSkill(PrimarySkill::ATTACK) + 1;
-		maxDmg *= retreiveHeroPrimSkill(PrimarySkill::ATTACK) + 1;
+		minDmg *= attackerStats.heroAttack + 1;
+		maxDmg *= attackerStats.heroAttack + 1;
 	}
 
 	int attackDefenceDifference = 0;
 
-	double multAttackReduction = (100 - battleBonusValue (info.attackerBonuses, Selector::type(Bonus::GENERAL_ATTACK_REDUCTION))) / 100.0;
-	attackDefenceDifference += battleBonusValue (info.attackerBonuses, Selector::typeSubtype(Bonus::PRIMARY_SKILL, PrimarySkill::ATTACK)) * multAttackReduction;
-
-	double multDefenceReduction = (100 - battleBonusValue (info.attackerBonuses, Selector::type(Bonus::ENEMY_DEFENCE_REDUCTION))) / 100.0;
-	attackDefenceDifference -= info.defenderBonuses->Defense() * multDefenceReduction;
+	attackDefenceDifference += attackerStats.attack * attackerStats.multAttackReduction;
+	attackDefenceDifference -= defenderStats.defence * attackerStats.multDefenceReduction;
 
-	if(const std::shared_ptr<Bonus> slayerEffect = info.attackerBonuses->getBonus(Selector::type(Bonus::SLAYER))) //slayer handling //TODO: apply only ONLY_MELEE_FIGHT / DISTANCE_FIGHT?
+	if(attackerStats.slayerLevel >= 0) //slayer handling
 	{
-		std::vector<int> affectedIds;
-		int spLevel = slayerEffect->val;
-
-		//FIXME: do not check all creatures
-		for(int g = 0; g < VLC->creh->creatures.size(); ++g)
-		{
-			for(const std::shared_ptr<Bonus> b : VLC->creh->creatures[g]->getBonusList())
-			{
-				if ((b->type == Bonus::KING3 && spLevel >= 3) || //expert
-					 (b->type == Bonus::KING2 && spLevel >= 2) || //adv +
-					 (b->type == Bonus::KING1 && spLevel >= 0)) //none or basic +
-				{
-					affectedIds.push_back(g);
-					break;
-				}
-			}
-		}
+		const int spLevel = attackerStats.slayerLevel;
 
-		for(auto & affectedId : affectedIds)
+		for(const std::shared_ptr<Bonus> b : defenderType->getBonusList())
 		{
-			if(defenderType->idNumber == affectedId)
+			if ((b->type == Bonus::KING3 && spLevel >= 3) || //expert
+				 (b->type == Bonus::KING2 && spLevel >= 2) || //adv +
+				 (b->type == Bonus::KING1 && spLevel >= 0)) //none or basic +
 			{
 				attackDefenceDifference += SpellID(SpellID::SLAYER).toSpell()->getPower(spLevel);
 				break;
@@ -648,17 +715,12 @@ TDmgRange CBattleInfoCallback::calculateDmgRange(const BattleAttackInfo & info)
 	}
 
 	//applying jousting bonus
-	if(info.attackerBonuses->hasBonusOfType(Bonus::JOUSTING) && !info.defenderBonuses->hasBonusOfType(Bonus::CHARGE_IMMUNITY))
+	if(attackerStats.jousting && !defenderStats.chargeImmunity)
 		additiveBonus += info.chargedFields * 0.05;
 
 	//handling secondary abilities and artifacts giving premies to them
-	if(info.shooting)
-		additiveBonus += info.attackerBonuses->valOfBonuses(Bonus::SECONDARY_SKILL_PREMY, SecondarySkill::ARCHERY) / 100.0;
-	else
-		additiveBonus += info.attackerBonuses->valOfBonuses(Bonus::SECONDARY_SKILL_PREMY, SecondarySkill::OFFENCE) / 100.0;
-
-	if(info.defenderBonuses)
-		multBonus *= (std::max(0, 100 - info.defenderBonuses->valOfBonuses(Bonus::SECONDARY_SKILL_PREMY, SecondarySkill::ARMORER))) / 100.0;
+	additiveBonus += attackerStats.skillPremy / 100.0;
+	multBonus *= defenderStats.armorerMultiplier;
 
 	//handling hate effect
 	additiveBonus += info.attackerBonuses->valOfBonuses(Bonus::HATE, defenderType->idNumber.toEnum()) / 100.;
@@ -686,58 +748,31 @@ TDmgRange CBattleInfoCallback::calculateDmgRange(const BattleAttackInfo & info)
 	}
 
 	//handling spell effects
-	if(!info.shooting) //eg. shield
-	{
-		multBonus *= (100 - info.defenderBonuses->valOfBonuses(Bonus::GENERAL_DAMAGE_REDUCTION, 0)) / 100.0;
-	}
-	else if(info.shooting) //eg. air shield
-	{
-		multBonus *= (100 - info.defenderBonuses->valOfBonuses(Bonus::GENERAL_DAMAGE_REDUCTION, 1)) / 100.0;
-	}
+	multBonus *= defenderStats.damageReductionMultiplier;
 
-	if(info.shooting)
+	if(info.shooting && attackerStats.forgetful)
 	{
 		//todo: set actual percentage in spell bonus configuration instead of just level; requires non trivial backward compatibility handling
 
-		//get list first, total value of 0 also counts
-		TBonusListPtr forgetfulList = info.attackerBonuses->getBonuses(Selector::type(Bonus::FORGETFULL),"");
-
-		if(!forgetfulList->empty())
-		{
-			int forgetful = forgetfulList->valOfBonuses(Selector::type(Bonus::FORGETFULL));
-
-			//none of basic level
-			if(forgetful == 0 || forgetful == 1)
-				multBonus *= 0.5;
-			else
-				logGlobal->warn("Attempt to calculate shooting damage with adv+ FORGETFULL effect");
-		}
+		//none of basic level
+		if(attackerStats.forgetfulLevel == 0 || attackerStats.forgetfulLevel == 1)
+			multBonus *= 0.5;
+		else
+			logGlobal->warn("Attempt to calculate shooting damage with adv+ FORGETFULL effect");
 	}
 
-	TBonusListPtr curseEffects = info.attackerBonuses->getBonuses(Selector::type(Bonus::ALWAYS_MINIMUM_DAMAGE));
-	TBonusListPtr blessEffects = info.attackerBonuses->getBonuses(Selector::type(Bonus::ALWAYS_MAXIMUM_DAMAGE));
-	int curseBlessAdditiveModifier = blessEffects->totalValue() - curseEffects->totalValue();
-	double curseMultiplicativePenalty = curseEffects->size() ? (*std::max_element(curseEffects->begin(), curseEffects->end(), &Bonus::compareByAdditionalInfo<std::shared_ptr<Bonus>>))->additionalInfo : 0;
-
-	if(curseMultiplicativePenalty) //curse handling (partial, the rest is below)
+	if(attackerStats.curseMultiplicativePenalty) //curse handling (partial, the rest is below)
 	{
-		multBonus *= 1.0 - curseMultiplicativePenalty/100;
+		multBonus *= 1.0 - attackerStats.curseMultiplicativePenalty/100;
 	}
 
-	auto isAdvancedAirShield = [](const Bonus* bonus)
-	{
-		return bonus->source == Bonus::SPELL_EFFECT
-				&& bonus->sid == SpellID::AIR_SHIELD
-				&& bonus->val >= SecSkillLevel::ADVANCED;
-	};
-
 	//wall / distance penalty + advanced air shield
-	const bool distPenalty = !info.attackerBonuses->hasBonusOfType(Bonus::NO_DISTANCE_PENALTY) && battleHasDistancePenalty(info.attackerBonuses, info.attackerPosition, info.defenderPosition);
-	const bool obstaclePenalty = battleHasWallPenalty(info.attackerBonuses, info.attackerPosition, info.defenderPosition);
-
 	if(info.shooting)
 	{
-		if (distPenalty || info.defenderBonuses->hasBonus(isAdvancedAirShield))
+		const bool distPenalty = !attackerStats.noDistancePenalty && battleHasDistancePenalty(info.attackerBonuses, info.attackerPosition, info.defenderPosition);
+		const bool obstaclePenalty = battleHasWallPenalty(info.attackerBonuses, info.attackerPosition, info.defenderPosition);
+
+		if (distPenalty || defenderStats.advancedAirShield)
 		{
 			multBonus *= 0.5;
 		}
@@ -746,14 +781,14 @@ TDmgRange CBattleInfoCallback::calculateDmgRange(const BattleAttackInfo & info)
 			multBonus *= 0.5; //cumulative
 		}
 	}
-	if(!info.shooting && info.attackerBonuses->hasBonusOfType(Bonus::SHOOTER) && !info.attackerBonuses->hasBonusOfType(Bonus::NO_MELEE_PENALTY))
+	if(attackerStats.meleePenalty)
 	{
 		multBonus *= 0.5;
 	}
 
 	// psychic elementals versus mind immune units 50%
 	if(attackerType->idNumber == CreatureID::PSYCHIC_ELEMENTAL
-	&& info.defenderBonuses->hasBonusOfType(Bonus::MIND_IMMUNITY))
+	&& defenderStats.mindImmunity)
 	{
 		multBonus *= 0.5;
 	}
@@ -766,14 +801,14 @@ TDmgRange CBattleInfoCallback::calculateDmgRange(const BattleAttackInfo & info)
 
 	TDmgRange returnedVal;
 
-	if(curseEffects->size()) //curse handling (rest)
+	if(attackerStats.cursed) //curse handling (rest)
 	{
-		minDmg += curseBlessAdditiveModifier;
+		minDmg += attackerStats.curseBlessAdditiveModifier;
 		returnedVal = std::make_pair(int(minDmg), int(minDmg));
 	}
-	else if(blessEffects->size()) //bless handling
+	else if(attackerStats.blessed) //bless handling
 	{
-		maxDmg += curseBlessAdditiveModifier;
+		maxDmg += attackerStats.curseBlessAdditiveModifier;
 		returnedVal = std::make_pair(int(maxDmg), int(maxDmg));
 	}
 	else
@@ -797,12 +832,18 @@ TDmgRange CBattleInfoCallback::battleEstimateDamage(CRandomGenerator & rand, con
 }
 
 std::pair<ui32, ui32> CBattleInfoCallback::battleEstimateDamage(CRandomGenerator & rand, const BattleAttackInfo & bai, std::pair<ui32, ui32> * retaliationDmg) const
+{
+	DamageStatsCache cache;
+	return battleEstimateDamage(rand, bai, retaliationDmg, cache);
+}
+
+std::pair<ui32, ui32> CBattleInfoCallback::battleEstimateDamage(CRandomGenerator & rand, const BattleAttackInfo & bai, std::pair<ui32, ui32> * retaliationDmg, DamageStatsCache & cache) const
 {
 	RETURN_IF_NOT_BATTLE(std::make_pair(0, 0));
 
 	//const bool shooting = battleCanShoot(bai.attacker, bai.defenderPosition); //TODO handle bonus bearer
 
-	TDmgRange ret = calculateDmgRange(bai);
+	TDmgRange ret = calculateDmgRange(bai, cache);
 
 	if(retaliationDmg)
 	{
@@ -821,7 +862,7 @@ std::pair<ui32, ui32> CBattleInfoCallback::battleEstimateDamage(CRandomGenerator
 
 				auto retaliationAttack = bai.reverse();
 				retaliationAttack.attackerHealth = retaliationAttack.attacker->healthAfterAttacked(bsa.damageAmount);
-				retaliationDmg->*pairElems[!i] = calculateDmgRange(retaliationAttack).*pairElems[!i];
+				retaliationDmg->*pairElems[!i] = calculateDmgRange(retaliationAttack, cache).*pairElems[!i];
 			}
 		}
 	}
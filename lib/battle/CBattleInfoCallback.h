@@ -31,6 +31,54 @@ struct DLL_LINKAGE AttackableTiles
 	}
 };
 
+/// Bonus-dependent values of attacking stack used in damage calculation, they do not depend on attacked stack
+struct DLL_LINKAGE AttackerDamageStats
+{
+	AttackerDamageStats(const IBonusBearer * bearer, bool shooting);
+
+	ui32 minDamage, maxDamage; //per creature
+	bool siegeWeapon;
+	int heroAttack; //primary skill of hero for siege weapons
+	int attack;
+	double multAttackReduction, multDefenceReduction;
+	int slayerLevel; //-1 if there is no slayer effect
+	bool jousting;
+	int skillPremy; //archery or offence
+	bool forgetful;
+	int forgetfulLevel;
+	bool cursed, blessed;
+	int curseBlessAdditiveModifier;
+	double curseMultiplicativePenalty;
+	bool noDistancePenalty;
+	bool meleePenalty;
+};
+
+/// Bonus-dependent values of attacked stack used in damage calculation, they do not depend on attacking stack
+struct DLL_LINKAGE DefenderDamageStats
+{
+	DefenderDamageStats(const IBonusBearer * bearer, bool shooting);
+
+	int defence;
+	bool chargeImmunity;
+	bool mindImmunity;
+	bool advancedAirShield;
+	double armorerMultiplier;
+	double damageReductionMultiplier;
+};
+
+/// Keeps damage stats of bonus bearers so that many attacks between the same stacks need only one set of bonus queries.
+/// Cached values are not updated on bonus changes, so cache should be used only for single evaluation.
+class DLL_LINKAGE DamageStatsCache : public boost::noncopyable
+{
+public:
+	const AttackerDamageStats & getAttackerStats(const IBonusBearer * bearer, bool shooting);
+	const DefenderDamageStats & getDefenderStats(const IBonusBearer * bearer, bool shooting);
+
+private:
+	std::map<std::pair<const IBonusBearer *, bool>, AttackerDamageStats> attackers;
+	std::map<std::pair<const IBonusBearer *, bool>, DefenderDamageStats> defenders;
+};
+
 class DLL_LINKAGE CBattleInfoCallback : public virtual CBattleInfoEssentials
 {
 public:
@@ -60,9 +108,11 @@ public:
 	std::set<const CStack*> batteAdjacentCreatures (const CStack * stack) const;
 
 	TDmgRange calculateDmgRange(const BattleAttackInfo & info) const; //charge - number of hexes travelled before attack (for champion's jousting); returns pair <min dmg, max dmg>
+	TDmgRange calculateDmgRange(const BattleAttackInfo & info, DamageStatsCache & cache) const;
 
 	//hextowallpart //int battleGetWallUnderHex(BattleHex hex) const; //returns part of destructible wall / gate / keep under given hex or -1 if not found
 	std::pair<ui32, ui32> battleEstimateDamage(CRandomGenerator & rand, const BattleAttackInfo & bai, std::pair<ui32, ui32> * retaliationDmg = nullptr) const; //estimates damage dealt by attacker to defender; it may be not precise especially when stack has randomly working bonuses; returns pair <min dmg, max dmg>
+	std::pair<ui32, ui32> battleEstimateDamage(CRandomGenerator & rand, const BattleAttackInfo & bai, std::pair<ui32, ui32> * retaliationDmg, DamageStatsCache & cache) const;
 	std::pair<ui32, ui32> battleEstimateDamage(CRandomGenerator & rand, const CStack * attacker, const CStack * defender, std::pair<ui32, ui32> * retaliationDmg = nullptr) const; //estimates damage dealt by attacker to defender; it may be not precise especially when stack has randomly working bonuses; returns pair <min dmg, max dmg>
 	si8 battleHasDistancePenalty(const CStack * stack, BattleHex destHex) const;
 	si8 battleHasDistancePenalty(const IBonusBearer * bonusBearer, BattleHex shooterPosition, BattleHex destHex) const;
@@ -108,4 +158,5 @@ protected:
 	ReachabilityInfo makeBFS(const AccessibilityInfo & accessibility, const ReachabilityInfo::Parameters & params) const;
 	ReachabilityInfo makeBFS(const CStack * stack) const; //uses default parameters -> stack position and owner's perspective
 	std::set<BattleHex> getStoppers(BattlePerspective::BattlePerspective whichSidePerspective) const; //get hexes with stopping obstacles (quicksands)
+	TDmgRange calculateDmgRange(const BattleAttackInfo & info, const AttackerDamageStats & attackerStats, const DefenderDamageStats & defenderStats) const;
 };
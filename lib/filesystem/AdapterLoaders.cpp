@@ -15,7 +15,7 @@
 
 CMappedFileLoader::CMappedFileLoader(const std::string & mountPoint, const JsonNode &config)
 {
-	for(auto entry : config.Struct())
+	for(auto & entry : config.Struct())
 	{
 		//fileList[ResourceID(mountPoint + entry.first)] = ResourceID(mountPoint + entry.second.String());
 		fileList.emplace(ResourceID(mountPoint + entry.first), ResourceID(mountPoint + entry.second.String()));
@@ -54,7 +54,10 @@ std::unordered_set<ResourceID> CMappedFileLoader::getFilteredFiles(std::function
 	return foundID;
 }
 
-CFilesystemList::CFilesystemList()
+CFilesystemList::CFilesystemList():
+	parent(nullptr),
+	indexRevision(0),
+	revision(1)
 {
 	//loaders = new std::vector<std::unique_ptr<ISimpleResourceLoader> >;
 }
@@ -64,14 +67,44 @@ CFilesystemList::~CFilesystemList()
 	//delete loaders;
 }
 
+const ISimpleResourceLoader * CFilesystemList::findLoader(const ResourceID & resourceName) const
+{
+	boost::unique_lock<boost::mutex> lock(indexMutex);
+
+	if (indexRevision != revision)
+		rebuildIndex();
+
+	auto it = index.find(resourceName);
+	if (it == index.end())
+		return nullptr;
+	return it->second;
+}
+
+void CFilesystemList::rebuildIndex() const
+{
+	const size_t currentRevision = revision;
+
+	index.clear();
+	// later loaders override resources from earlier ones
+	for (auto & loader : loaders)
+		for (auto & entry : loader->getFilteredFiles([](const ResourceID &){ return true; }))
+			index[entry] = loader.get();
+
+	indexRevision = currentRevision;
+}
+
+void CFilesystemList::markChanged() const
+{
+	revision++;
+	if (parent)
+		parent->markChanged();
+}
+
 std::unique_ptr<CInputStream> CFilesystemList::load(const ResourceID & resourceName) const
 {
 	// load resource from last loader that have it (last overridden version)
-	for (auto & loader : boost::adaptors::reverse(loaders))
-	{
-		if (loader->existsResource(resourceName))
-			return loader->load(resourceName);
-	}
+	if (auto loader = findLoader(resourceName))
+		return loader->load(resourceName);
 
 	throw std::runtime_error("Resource with name " + resourceName.getName() + " and type "
 		+ EResTypeHelper::getEResTypeAsString(resourceName.getType()) + " wasn't found.");
@@ -79,10 +112,7 @@ std::unique_ptr<CInputStream> CFilesystemList::load(const ResourceID & resourceN
 
 bool CFilesystemList::existsResource(const ResourceID & resourceName) const
 {
-	for (auto & loader : loaders)
-		if (loader->existsResource(resourceName))
-			return true;
-	return false;
+	return findLoader(resourceName) != nullptr;
 }
 
 std::string CFilesystemList::getMountPoint() const
@@ -92,8 +122,8 @@ std::string CFilesystemList::getMountPoint() const
 
 boost::optional<boost::filesystem::path> CFilesystemList::getResourceName(const ResourceID & resourceName) const
 {
-	if (existsResource(resourceName))
-		return getResourcesWithName(resourceName).back()->getResourceName(resourceName);
+	if (auto loader = findLoader(resourceName))
+		return loader->getResourceName(resourceName);
 	return boost::optional<boost::filesystem::path>();
 }
 
@@ -115,6 +145,7 @@ void CFilesystemList::updateFilteredFiles(std::function<bool(const std::string &
 {
 	for (auto & loader : loaders)
 		loader->updateFilteredFiles(filter);
+	markChanged();
 }
 
 std::unordered_set<ResourceID> CFilesystemList::getFilteredFiles(std::function<bool(const ResourceID &)> filter) const
@@ -139,6 +170,7 @@ bool CFilesystemList::createResource(std::string filename, bool update)
 			// Check if resource was created successfully. Possible reasons for this to fail
 			// a) loader failed to create resource (e.g. read-only FS)
 			// b) in update mode, call with filename that does not exists
+			markChanged();
 			assert(load(ResourceID(filename)));
 
 			logGlobal->trace("Resource created successfully");
@@ -161,7 +193,24 @@ std::vector<const ISimpleResourceLoader *> CFilesystemList::getResourcesWithName
 
 void CFilesystemList::addLoader(ISimpleResourceLoader * loader, bool writeable)
 {
+	boost::unique_lock<boost::mutex> lock(indexMutex);
+
 	loaders.push_back(std::unique_ptr<ISimpleResourceLoader>(loader));
 	if (writeable)
 		writeableLoaders.insert(loader);
+
+	auto list = dynamic_cast<CFilesystemList *>(loader);
+	if (list)
+		list->parent = this;
+
+	if (parent)
+		parent->markChanged();
+
+	// if index was up to date it is enough to add files from new loader on top of it
+	if (revision++ == indexRevision)
+	{
+		for (auto & entry : loader->getFilteredFiles([](const ResourceID &){ return true; }))
+			index[entry] = loader;
+		indexRevision++;
+	}
 }
@@ -57,6 +57,22 @@ class DLL_LINKAGE CFilesystemList : public ISimpleResourceLoader
 
 	std::set<ISimpleResourceLoader *> writeableLoaders;
 
+	/// List that owns this one, if any
+	CFilesystemList * parent;
+
+	/// For each known resource - loader that provides its last (overriding) version
+	/// Rebuilt on demand whenever this list or any nested list was modified since last build
+	mutable std::unordered_map<ResourceID, const ISimpleResourceLoader *> index;
+	mutable size_t indexRevision;
+	mutable std::atomic<size_t> revision;
+	mutable boost::mutex indexMutex;
+
+	/// Returns loader that should be used for this resource or nullptr if resource is unknown
+	const ISimpleResourceLoader * findLoader(const ResourceID & resourceName) const;
+	void rebuildIndex() const;
+	/// Invalidates index of this list and of all lists that contain it
+	void markChanged() const;
+
 	//FIXME: this is only compile fix, should be removed in the end
 	CFilesystemList(CFilesystemList &) = delete;
 	CFilesystemList &operator=(CFilesystemList &) = delete;
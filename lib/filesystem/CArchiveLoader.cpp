@@ -12,9 +12,25 @@
 
 #include "CFileInputStream.h"
 #include "CCompressedStream.h"
+#include "CMemoryStream.h"
 
 #include "CBinaryReader.h"
 
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+/// Read-only view into a mapped archive. Keeps mapping alive for as long as stream exists
+class CMappedStream : public CMemoryStream
+{
+	std::shared_ptr<boost::interprocess::mapped_region> mapping;
+public:
+	CMappedStream(std::shared_ptr<boost::interprocess::mapped_region> mapping, si64 offset, si64 size):
+		CMemoryStream(static_cast<const ui8 *>(mapping->get_address()) + offset, size),
+		mapping(std::move(mapping))
+	{
+	}
+};
+
 ArchiveEntry::ArchiveEntry()
 	: offset(0), fullSize(0), compressedSize(0)
 {
@@ -45,9 +61,25 @@ CArchiveLoader::CArchiveLoader(std::string _mountPoint, boost::filesystem::path
 	else
 		throw std::runtime_error("LOD archive format unknown. Cannot deal with " + archive.string());
 
+	mapArchive();
+
 	logGlobal->trace("%sArchive \"%s\" loaded (%d files found).", ext, archive.filename(), entries.size());
 }
 
+void CArchiveLoader::mapArchive()
+{
+	try
+	{
+		boost::interprocess::file_mapping file(archive.string().c_str(), boost::interprocess::read_only);
+		mapping = std::make_shared<boost::interprocess::mapped_region>(file, boost::interprocess::read_only);
+	}
+	catch(boost::interprocess::interprocess_exception & e)
+	{
+		logGlobal->warn("Failed to map archive %s: %s", archive.string(), e.what());
+		mapping.reset();
+	}
+}
+
 void CArchiveLoader::initLODArchive(const std::string &mountPoint, CFileInputStream & fileStream)
 {
 	// Read count of total files
@@ -146,6 +178,19 @@ std::unique_ptr<CInputStream> CArchiveLoader::load(const ResourceID & resourceNa
 
 	const ArchiveEntry & entry = entries.at(resourceName);
 
+	const si64 storedSize = entry.compressedSize != 0 ? entry.compressedSize : entry.fullSize;
+
+	// entries pointing outside of archive go through file stream which handles this case gracefully
+	if(mapping && entry.offset >= 0 && storedSize >= 0 && entry.offset + storedSize <= static_cast<si64>(mapping->get_size()))
+	{
+		if(entry.compressedSize != 0)
+		{
+			auto view = make_unique<CMappedStream>(mapping, entry.offset, entry.compressedSize);
+			return make_unique<CCompressedStream>(std::move(view), false, entry.fullSize);
+		}
+		return make_unique<CMappedStream>(mapping, entry.offset, entry.fullSize);
+	}
+
 	if (entry.compressedSize != 0) //compressed data
 	{
 		auto fileStream = make_unique<CFileInputStream>(archive, entry.offset, entry.compressedSize);
@@ -14,6 +14,14 @@
 
 class CFileInputStream;
 
+namespace boost
+{
+namespace interprocess
+{
+	class mapped_region;
+}
+}
+
 /**
  * A struct which holds information about the archive entry e.g. where it is located in space of the archive container.
  */
@@ -85,9 +93,18 @@ private:
 	 */
 	void initSNDArchive(const std::string &mountPoint, CFileInputStream & fileStream);
 
+	/**
+	 * Maps the whole archive into memory.
+	 * On failure archive stays unmapped and entries are read through file streams.
+	 */
+	void mapArchive();
+
 	/** The file path to the archive which is scanned and indexed. */
 	boost::filesystem::path archive;
 
+	/** Read-only mapping of the archive, shared with all streams created from it. May be null. **/
+	std::shared_ptr<boost::interprocess::mapped_region> mapping;
+
 	std::string mountPoint;
 
 	/** Holds all entries of the archive file. An entry can be accessed via the entry name. **/
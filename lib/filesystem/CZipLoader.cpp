@@ -13,6 +13,50 @@
 
 #include "../ScopeGuard.h"
 
+CZipHandlePool::CZipHandlePool(std::shared_ptr<CIOApi> api, const boost::filesystem::path & archive):
+	api(api),
+	archive(archive)
+{
+}
+
+CZipHandlePool::~CZipHandlePool()
+{
+	for(unzFile file : handles)
+		unzClose(file);
+}
+
+unzFile CZipHandlePool::acquire()
+{
+	{
+		boost::unique_lock<boost::mutex> lock(mx);
+		if(!handles.empty())
+		{
+			unzFile file = handles.back();
+			handles.pop_back();
+			return file;
+		}
+	}
+
+	zlib_filefunc64_def zlibApi = api->getApiStructure();
+	return unzOpen2_64(archive.c_str(), &zlibApi);
+}
+
+void CZipHandlePool::release(unzFile file)
+{
+	if(file == nullptr)
+		return;
+
+	{
+		boost::unique_lock<boost::mutex> lock(mx);
+		if(handles.size() < MAX_IDLE_HANDLES)
+		{
+			handles.push_back(file);
+			return;
+		}
+	}
+	unzClose(file);
+}
+
 CZipStream::CZipStream(std::shared_ptr<CIOApi> api, const boost::filesystem::path & archive, unz64_file_pos filepos)
 {
 	zlib_filefunc64_def zlibApi;
@@ -24,10 +68,21 @@ CZipStream::CZipStream(std::shared_ptr<CIOApi> api, const boost::filesystem::pat
 	unzOpenCurrentFile(file);
 }
 
+CZipStream::CZipStream(std::shared_ptr<CZipHandlePool> pool, unz64_file_pos filepos):
+	pool(pool),
+	file(pool->acquire())
+{
+	unzGoToFilePos64(file, &filepos);
+	unzOpenCurrentFile(file);
+}
+
 CZipStream::~CZipStream()
 {
 	unzCloseCurrentFile(file);
-	unzClose(file);
+	if(pool)
+		pool->release(file);
+	else
+		unzClose(file);
 }
 
 si64 CZipStream::readMore(ui8 * data, si64 size)
@@ -55,6 +110,7 @@ CZipLoader::CZipLoader(const std::string & mountPoint, const boost::filesystem::
     zlibApi(ioApi->getApiStructure()),
     archiveName(archive),
     mountPoint(mountPoint),
+    handles(std::make_shared<CZipHandlePool>(ioApi, archive)),
     files(listFiles(mountPoint, archive))
 {
 	logGlobal->trace("Zip archive loaded, %d files found", files.size());
@@ -64,7 +120,7 @@ std::unordered_map<ResourceID, unz64_file_pos> CZipLoader::listFiles(const std::
 {
 	std::unordered_map<ResourceID, unz64_file_pos> ret;
 
-	unzFile file = unzOpen2_64(archive.c_str(), &zlibApi);
+	unzFile file = handles->acquire();
 
 	if(file == nullptr)
 		logGlobal->error("%s failed to open", archive.string());
@@ -87,14 +143,15 @@ std::unordered_map<ResourceID, unz64_file_pos> CZipLoader::listFiles(const std::
 		}
 		while (unzGoToNextFile(file) == UNZ_OK);
 	}
-	unzClose(file);
+	// keep handle opened for streams created later
+	handles->release(file);
 
 	return ret;
 }
 
 std::unique_ptr<CInputStream> CZipLoader::load(const ResourceID & resourceName) const
 {
-	return std::unique_ptr<CInputStream>(new CZipStream(ioApi, archiveName, files.at(resourceName)));
+	return std::unique_ptr<CInputStream>(new CZipStream(handles, files.at(resourceName)));
 }
 
 bool CZipLoader::existsResource(const ResourceID & resourceName) const
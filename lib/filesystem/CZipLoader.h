@@ -16,8 +16,31 @@
 
 #include "MinizipExtensions.h"
 
+/// Keeps opened handles to one archive so streams don't have to reopen it and locate central directory each time
+class DLL_LINKAGE CZipHandlePool : boost::noncopyable
+{
+	/// Max number of idle handles kept opened, handles above this limit are closed on release
+	static const size_t MAX_IDLE_HANDLES = 4;
+
+	std::shared_ptr<CIOApi> api;
+	boost::filesystem::path archive;
+
+	boost::mutex mx;
+	std::vector<unzFile> handles;
+
+public:
+	CZipHandlePool(std::shared_ptr<CIOApi> api, const boost::filesystem::path & archive);
+	~CZipHandlePool();
+
+	/// returns idle handle or opens new one, nullptr on failure
+	unzFile acquire();
+	/// returns handle to pool, file must not have current file opened
+	void release(unzFile file);
+};
+
 class DLL_LINKAGE CZipStream : public CBufferedStream
 {
+	std::shared_ptr<CZipHandlePool> pool;
 	unzFile file;
 
 public:
@@ -28,6 +51,13 @@ public:
 	 * @param filepos position of file to open
 	 */
 	CZipStream(std::shared_ptr<CIOApi> api, const boost::filesystem::path & archive, unz64_file_pos filepos);
+
+	/**
+	 * @brief constructs zip stream using archive handle from pool
+	 * @param pool pool of handles to archive, handle is returned to it on destruction
+	 * @param filepos position of file to open
+	 */
+	CZipStream(std::shared_ptr<CZipHandlePool> pool, unz64_file_pos filepos);
 	~CZipStream();
 
 	si64 getSize() override;
@@ -44,6 +74,8 @@ class DLL_LINKAGE CZipLoader : public ISimpleResourceLoader
 	boost::filesystem::path archiveName;
 	std::string mountPoint;
 
+	std::shared_ptr<CZipHandlePool> handles;
+
 	std::unordered_map<ResourceID, unz64_file_pos> files;
 
 	std::unordered_map<ResourceID, unz64_file_pos> listFiles(const std::string & mountPoint, const boost::filesystem::path &archive);
@@ -85,7 +85,10 @@ void CBasicLogConfigurator::configure()
 			const JsonNode & fileFormatNode = fileNode["format"];
 			if(!fileFormatNode.isNull()) fileTarget->setFormatter(CLogFormatter(fileFormatNode.String()));
 		}
-		CLogger::getGlobalLogger()->addTarget(std::move(fileTarget));
+		if(fileNode["async"].Bool())
+			CLogger::getGlobalLogger()->addTarget(make_unique<CLogAsyncTarget>(std::move(fileTarget)));
+		else
+			CLogger::getGlobalLogger()->addTarget(std::move(fileTarget));
 		appendToLogFile = true;
 	}
 	catch(const std::exception & e)
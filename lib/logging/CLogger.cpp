@@ -123,11 +123,12 @@ CLogger::CLogger(const CLoggerDomain & domain) : domain(domain)
 		level = ELogLevel::NOT_SET;
 		parent = getLogger(domain.getParent());
 	}
+	effectiveLevel = computeEffectiveLevel();
 }
 
 void CLogger::log(ELogLevel::ELogLevel level, const std::string & message) const
 {
-	if(getEffectiveLevel() <= level)
+	if(isEnabledFor(level))
 		callTargets(LogRecord(domain, level, message));
 }
 
@@ -151,9 +152,14 @@ ELogLevel::ELogLevel CLogger::getLevel() const
 
 void CLogger::setLevel(ELogLevel::ELogLevel level)
 {
-	TLockGuard _(mx);
-	if (!domain.isGlobalDomain() || level != ELogLevel::NOT_SET)
-		this->level = level;
+	{
+		TLockGuard _(mx);
+		if (!domain.isGlobalDomain() || level != ELogLevel::NOT_SET)
+			this->level = level;
+	}
+	// logger may be not registered yet, and effective level of its children may depend on it
+	updateEffectiveLevel();
+	CLogManager::get().updateEffectiveLevels();
 }
 
 const CLoggerDomain & CLogger::getDomain() const { return domain; }
@@ -165,6 +171,16 @@ void CLogger::addTarget(std::unique_ptr<ILogTarget> && target)
 }
 
 ELogLevel::ELogLevel CLogger::getEffectiveLevel() const
+{
+	return effectiveLevel;
+}
+
+void CLogger::updateEffectiveLevel()
+{
+	effectiveLevel = computeEffectiveLevel();
+}
+
+ELogLevel::ELogLevel CLogger::computeEffectiveLevel() const
 {
 	for(const CLogger * logger = this; logger != nullptr; logger = logger->parent)
 		if(logger->getLevel() != ELogLevel::NOT_SET)
@@ -190,6 +206,7 @@ void CLogger::clearTargets()
 
 bool CLogger::isDebugEnabled() const { return getEffectiveLevel() <= ELogLevel::DEBUG; }
 bool CLogger::isTraceEnabled() const { return getEffectiveLevel() <= ELogLevel::TRACE; }
+bool CLogger::isEnabledFor(ELogLevel::ELogLevel level) const { return getEffectiveLevel() <= level; }
 
 CLogManager & CLogManager::get()
 {
@@ -221,6 +238,13 @@ CLogger * CLogManager::getLogger(const CLoggerDomain & domain)
 		return nullptr;
 }
 
+void CLogManager::updateEffectiveLevels()
+{
+	TLockGuard _(mx);
+	for(auto & entry : loggers)
+		entry.second->updateEffectiveLevel();
+}
+
 std::vector<std::string> CLogManager::getRegisteredDomains() const
 {
 	std::vector<std::string> domains;
@@ -399,3 +423,49 @@ void CLogFileTarget::write(const LogRecord & record)
 
 const CLogFormatter & CLogFileTarget::getFormatter() const { return formatter; }
 void CLogFileTarget::setFormatter(const CLogFormatter & formatter) { this->formatter = formatter; }
+
+CLogAsyncTarget::CLogAsyncTarget(std::unique_ptr<ILogTarget> target)
+	: target(std::move(target)), stopping(false)
+{
+	thread = boost::thread(&CLogAsyncTarget::run, this);
+}
+
+CLogAsyncTarget::~CLogAsyncTarget()
+{
+	{
+		TLockGuard _(mx);
+		stopping = true;
+	}
+	cond.notify_one();
+	thread.join();
+}
+
+void CLogAsyncTarget::write(const LogRecord & record)
+{
+	{
+		TLockGuard _(mx);
+		queue.push_back(record);
+	}
+	cond.notify_one();
+}
+
+void CLogAsyncTarget::run()
+{
+	std::deque<LogRecord> records;
+	while(true)
+	{
+		{
+			boost::unique_lock<boost::mutex> lock(mx);
+			while(queue.empty() && !stopping)
+				cond.wait(lock);
+
+			if(queue.empty()) // stopping and everything was written
+				return;
+			records.swap(queue);
+		}
+
+		for(auto & record : records)
+			target->write(record);
+		records.clear();
+	}
+}
@@ -66,15 +66,21 @@ public:
 	/// Useful if performance is important and concatenating the log message is a expensive task.
 	bool isDebugEnabled() const override;
 	bool isTraceEnabled() const override;
+	bool isEnabledFor(ELogLevel::ELogLevel level) const override;
 
 private:
+	friend class CLogManager;
+
 	explicit CLogger(const CLoggerDomain & domain);
 	inline ELogLevel::ELogLevel getEffectiveLevel() const; /// Returns the log level applied on this logger whether directly or indirectly.
+	ELogLevel::ELogLevel computeEffectiveLevel() const;
+	void updateEffectiveLevel();
 	inline void callTargets(const LogRecord & record) const;
 
 	CLoggerDomain domain;
 	CLogger * parent;
 	ELogLevel::ELogLevel level;
+	std::atomic<ELogLevel::ELogLevel> effectiveLevel; /// Cached result of computeEffectiveLevel, updated whenever level of any logger changes
 	std::vector<std::unique_ptr<ILogTarget> > targets;
 	mutable boost::mutex mx;
 	static boost::recursive_mutex smx;
@@ -93,6 +99,7 @@ public:
 	void addLogger(CLogger * logger);
 	CLogger * getLogger(const CLoggerDomain & domain); /// Returns a logger or nullptr if no one is registered for the given domain.
 	std::vector<std::string> getRegisteredDomains() const;
+	void updateEffectiveLevels(); /// Has to be called after level of any logger was changed
 
 private:
 	CLogManager();
@@ -225,3 +232,24 @@ private:
 	CLogFormatter formatter;
 	mutable boost::mutex mx;
 };
+
+/// This target passes log records to another target from a background thread, so logging threads don't wait for
+/// slow output like file flushes. Records that are still queued are written when the target is destroyed.
+class DLL_LINKAGE CLogAsyncTarget : public ILogTarget
+{
+public:
+	explicit CLogAsyncTarget(std::unique_ptr<ILogTarget> target);
+	~CLogAsyncTarget();
+
+	void write(const LogRecord & record) override;
+
+private:
+	void run();
+
+	std::unique_ptr<ILogTarget> target;
+	std::deque<LogRecord> queue;
+	bool stopping;
+	boost::mutex mx;
+	boost::condition_variable cond;
+	boost::thread thread;
+};
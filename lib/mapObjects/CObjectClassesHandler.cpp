@@ -197,7 +197,7 @@ CObjectClassesHandler::ObjectContainter * CObjectClassesHandler::loadFromJson(co
 	obj->handlerName = json["handler"].String();
 	obj->base = json["base"];
 	obj->id = selectNextID(json["index"], objects, 256);
-	for (auto entry : json["types"].Struct())
+	for (auto & entry : json["types"].Struct())
 	{
 		loadObjectEntry(entry.first, entry.second, obj);
 	}
@@ -459,34 +459,36 @@ void AObjectTypeHandler::addTemplate(JsonNode config)
 	templates.push_back(tmpl);
 }
 
-std::vector<ObjectTemplate> AObjectTypeHandler::getTemplates() const
+const std::vector<ObjectTemplate> & AObjectTypeHandler::getTemplates() const
 {
 	return templates;
 }
 
+bool AObjectTypeHandler::isTemplateAllowedOn(const ObjectTemplate & tmpl, si32 terrainType) const
+{
+	// H3 defines allowed terrains in a weird way - artifacts, monsters and resources have faulty masks here
+	// Perhaps we should re-define faulty templates and remove this workaround (already done for resources)
+	if (type == Obj::ARTIFACT || type == Obj::MONSTER)
+		return true;
+	return tmpl.canBePlacedAt(ETerrainType(terrainType));
+}
+
 std::vector<ObjectTemplate> AObjectTypeHandler::getTemplates(si32 terrainType) const// FIXME: replace with ETerrainType
 {
-	std::vector<ObjectTemplate> templates = getTemplates();
 	std::vector<ObjectTemplate> filtered;
 
 	std::copy_if(templates.begin(), templates.end(), std::back_inserter(filtered), [&](const ObjectTemplate & obj)
 	{
-		return obj.canBePlacedAt(ETerrainType(terrainType));
+		return isTemplateAllowedOn(obj, terrainType);
 	});
-	// H3 defines allowed terrains in a weird way - artifacts, monsters and resources have faulty masks here
-	// Perhaps we should re-define faulty templates and remove this workaround (already done for resources)
-	if (type == Obj::ARTIFACT || type == Obj::MONSTER)
-		return templates;
-	else
-		return filtered;
+	return filtered;
 }
 
 boost::optional<ObjectTemplate> AObjectTypeHandler::getOverride(si32 terrainType, const CGObjectInstance * object) const
 {
-	std::vector<ObjectTemplate> ret = getTemplates(terrainType);
-	for (auto & tmpl : ret)
+	for (auto & tmpl : templates)
 	{
-		if (objectFilter(object, tmpl))
+		if (isTemplateAllowedOn(tmpl, terrainType) && objectFilter(object, tmpl))
 			return tmpl;
 	}
 	return boost::optional<ObjectTemplate>();
@@ -111,6 +111,7 @@ class DLL_LINKAGE AObjectTypeHandler : public boost::noncopyable
 protected:
 	void preInitObject(CGObjectInstance * obj) const;
 	virtual bool objectFilter(const CGObjectInstance *, const ObjectTemplate &) const;
+	bool isTemplateAllowedOn(const ObjectTemplate & tmpl, si32 terrainType) const;
 
 	/// initialization for classes that inherit this one
 	virtual void initTypeData(const JsonNode & input);
@@ -136,7 +137,7 @@ public:
 	void addTemplate(JsonNode config);
 
 	/// returns all templates matching parameters
-	std::vector<ObjectTemplate> getTemplates() const;
+	const std::vector<ObjectTemplate> & getTemplates() const;
 	std::vector<ObjectTemplate> getTemplates(si32 terrainType) const;
 
 	/// returns preferred template for this object, if present (e.g. one of 3 possible templates for town - village, fort and castle)
@@ -55,7 +55,7 @@ void CRandomRewardObjectInfo::configureObject(CRewardableObject * object, CRando
 			si32 diceID = chance["dice"].Float();
 
 			if (thrownDice.count(diceID) == 0)
-				thrownDice[diceID] = rng.getIntRange(1, 100)();
+				thrownDice[diceID] = rng.nextInt(1, 100);
 
 			if (!chance["min"].isNull())
 			{
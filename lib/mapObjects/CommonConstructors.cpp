@@ -47,7 +47,7 @@ void CTownInstanceConstructor::initTypeData(const JsonNode & input)
 void CTownInstanceConstructor::afterLoadFinalization()
 {
 	assert(faction);
-	for (auto entry : filtersJson.Struct())
+	for (auto & entry : filtersJson.Struct())
 	{
 		filters[entry.first] = LogicalExpression<BuildingID>(entry.second, [this](const JsonNode & node)
 		{
@@ -101,7 +101,7 @@ void CHeroInstanceConstructor::initTypeData(const JsonNode & input)
 
 void CHeroInstanceConstructor::afterLoadFinalization()
 {
-	for (auto entry : filtersJson.Struct())
+	for (auto & entry : filtersJson.Struct())
 	{
 		filters[entry.first] = LogicalExpression<HeroTypeID>(entry.second, [this](const JsonNode & node)
 		{
@@ -33,7 +33,7 @@ namespace JsonRandom
 			return value["amount"].Float();
 		si32 min = value["min"].Float();
 		si32 max = value["max"].Float();
-		return rng.getIntRange(min, max)();
+		return rng.nextInt(min, max);
 	}
 
 	TResources loadResources(const JsonNode & value, CRandomGenerator & rng)
@@ -430,9 +430,10 @@ bool ObjectTemplate::isWithin(si32 X, si32 Y) const
 {
 	if (X < 0 || Y < 0)
 		return false;
-	if (X >= getWidth() || Y >= getHeight())
+	// all rows have the same length, so checking row of the tile is enough and avoids scanning all rows in getWidth()
+	if (Y >= static_cast<si32>(usedTiles.size()))
 		return false;
-	return true;
+	return X < static_cast<si32>(usedTiles[Y].size());
 }
 
 bool ObjectTemplate::isVisitableAt(si32 X, si32 Y) const
@@ -459,9 +460,11 @@ bool ObjectTemplate::isBlockedAt(si32 X, si32 Y) const
 std::set<int3> ObjectTemplate::getBlockedOffsets() const
 {
 	std::set<int3> ret;
-	for(int w = 0; w < getWidth(); ++w)
+	const int width = getWidth();
+	const int height = getHeight();
+	for(int w = 0; w < width; ++w)
 	{
-		for(int h = 0; h < getHeight(); ++h)
+		for(int h = 0; h < height; ++h)
 		{
 			if (isBlockedAt(w, h))
 				ret.insert(int3(-w, -h, 0));
@@ -472,9 +475,11 @@ std::set<int3> ObjectTemplate::getBlockedOffsets() const
 
 int3 ObjectTemplate::getBlockMapOffset() const
 {
-	for(int w = 0; w < getWidth(); ++w)
+	const int width = getWidth();
+	const int height = getHeight();
+	for(int w = 0; w < width; ++w)
 	{
-		for(int h = 0; h < getHeight(); ++h)
+		for(int h = 0; h < height; ++h)
 		{
 			if (isBlockedAt(w, h))
 				return int3(w, h, 0);
@@ -504,8 +509,10 @@ bool ObjectTemplate::isVisitableFrom(si8 X, si8 Y) const
 
 int3 ObjectTemplate::getVisitableOffset() const
 {
-	for(int y = 0; y < getHeight(); y++)
-		for (int x = 0; x < getWidth(); x++)
+	const int width = getWidth();
+	const int height = getHeight();
+	for(int y = 0; y < height; y++)
+		for (int x = 0; x < width; x++)
 			if (isVisitableAt(x, y))
 				return int3(x,y,0);
 
@@ -21,6 +21,7 @@
 #include "../spells/CSpellHandler.h"
 #include "CMapEditManager.h"
 #include "../serializer/JsonSerializeFormat.h"
+#include "../CThreadHelper.h"
 
 SHeroName::SHeroName() : heroId(-1)
 {
@@ -324,17 +325,45 @@ void CMap::addBlockVisTiles(CGObjectInstance * obj)
 	}
 }
 
-void CMap::calculateGuardingGreaturePositions()
+void CMap::calculateGuardingGreaturePositions(bool parallel)
 {
+	static const int COLUMNS_PER_TASK = 16;
+
 	int levels = twoLevel ? 2 : 1;
-	for (int i=0; i<width; i++)
+
+	if(!parallel)
 	{
-		for(int j=0; j<height; j++)
+		for (int i=0; i<width; i++)
 		{
-			for (int k = 0; k < levels; k++)
-				guardingCreaturePositions[i][j][k] = guardingCreaturePosition(int3(i,j,k));
+			for(int j=0; j<height; j++)
+			{
+				for (int k = 0; k < levels; k++)
+					guardingCreaturePositions[i][j][k] = guardingCreaturePosition(int3(i,j,k));
+			}
 		}
+		return;
 	}
+
+	// every tile is computed independently from read-only map data, so columns can be processed in parallel
+	std::vector<Task> tasks;
+	for(int first = 0; first < width; first += COLUMNS_PER_TASK)
+	{
+		int last = std::min(first + COLUMNS_PER_TASK, width);
+		tasks.push_back([=]()
+		{
+			for (int i=first; i<last; i++)
+			{
+				for(int j=0; j<height; j++)
+				{
+					for (int k = 0; k < levels; k++)
+						guardingCreaturePositions[i][j][k] = guardingCreaturePosition(int3(i,j,k));
+				}
+			}
+		});
+	}
+
+	CThreadHelper helper(&tasks, boost::thread::hardware_concurrency());
+	helper.run();
 }
 
 CGHeroInstance * CMap::getHero(int heroID)
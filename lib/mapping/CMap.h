@@ -364,7 +364,8 @@ public:
 
 	void addBlockVisTiles(CGObjectInstance * obj);
 	void removeBlockVisTiles(CGObjectInstance * obj, bool total = false);
-	void calculateGuardingGreaturePositions();
+	/// parallel computation is meant for full map initialization, incremental updates from net packs stay sequential
+	void calculateGuardingGreaturePositions(bool parallel = false);
 
 	void addNewArtifactInstance(CArtifactInstance * art);
 	void eraseArtifactInstance(CArtifactInstance * art);
@@ -11,8 +11,14 @@
 #include "CMapInfo.h"
 
 #include "../filesystem/ResourceID.h"
+#include "../filesystem/Filesystem.h"
+#include "../serializer/BinaryDeserializer.h"
+#include "../serializer/BinarySerializer.h"
 #include "../StartInfo.h"
 #include "../GameConstants.h"
+#include "../VCMI_Lib.h"
+#include "../CModHandler.h"
+#include "../CHeroHandler.h"
 #include "CMapService.h"
 
 void CMapInfo::countPlayers()
@@ -92,3 +98,116 @@ CMapInfo & CMapInfo::operator=(CMapInfo &&tmp)
 }
 
 #undef STEAL
+
+static const std::string MAP_HEADER_CACHE_MAGIC = "VCMIMHC";
+
+CMapHeaderCache::CMapHeaderCache(boost::filesystem::path cacheFile):
+	cacheFile(std::move(cacheFile)),
+	contentChecksum(calculateContentChecksum()),
+	changed(false)
+{
+	if(!boost::filesystem::exists(this->cacheFile))
+		return;
+
+	try
+	{
+		CLoadFile in(this->cacheFile);
+		in.checkMagicBytes(MAP_HEADER_CACHE_MAGIC);
+
+		ui32 storedChecksum;
+		in >> storedChecksum;
+		if(storedChecksum != contentChecksum)
+		{
+			// headers were loaded with different mods, e.g. allowedHeroes may not match current hero list
+			logGlobal->info("Map header cache %s dropped: active mods have changed", this->cacheFile.string());
+			changed = true;
+			return;
+		}
+		in >> entries;
+	}
+	catch(const std::exception & e)
+	{
+		// outdated or damaged cache, will be recreated
+		logGlobal->warn("Map header cache %s ignored: %s", this->cacheFile.string(), e.what());
+		entries.clear();
+	}
+}
+
+ui32 CMapHeaderCache::calculateContentChecksum()
+{
+	boost::crc_32_type result;
+	auto processValue = [&](ui32 value)
+	{
+		result.process_bytes(&value, sizeof(value));
+	};
+
+	for(auto & modName : VLC->modh->getActiveMods())
+	{
+		result.process_bytes(modName.data(), modName.size());
+		processValue(VLC->modh->getModData(modName).checksum);
+	}
+	processValue(static_cast<ui32>(VLC->heroh->heroes.size()));
+	return result.checksum();
+}
+
+void CMapHeaderCache::mapInit(CMapInfo & info, const std::string & fname)
+{
+	auto path = CResourceHandler::get()->getResourceName(ResourceID(fname, EResType::MAP));
+	if(!path) // not a separate file, e.g. map in archive
+	{
+		info.mapInit(fname);
+		return;
+	}
+
+	const std::string key = path->string();
+	const ui64 size = boost::filesystem::file_size(*path);
+	const si64 modified = boost::filesystem::last_write_time(*path);
+
+	usedEntries.insert(key);
+
+	auto it = entries.find(key);
+	if(it != entries.end() && it->second.size == size && it->second.modified == modified)
+	{
+		info.fileURI = fname;
+		info.mapHeader = make_unique<CMapHeader>(it->second.header);
+		info.countPlayers();
+		return;
+	}
+
+	info.mapInit(fname);
+
+	Entry & entry = entries[key];
+	entry.size = size;
+	entry.modified = modified;
+	entry.header = *info.mapHeader;
+	changed = true;
+}
+
+void CMapHeaderCache::save()
+{
+	for(auto it = entries.begin(); it != entries.end();)
+	{
+		if(!vstd::contains(usedEntries, it->first))
+		{
+			it = entries.erase(it);
+			changed = true;
+		}
+		else
+			it++;
+	}
+
+	if(!changed)
+		return;
+
+	try
+	{
+		CSaveFile out(cacheFile);
+		out.putMagicBytes(MAP_HEADER_CACHE_MAGIC);
+		out << contentChecksum << entries;
+		changed = false;
+	}
+	catch(const std::exception & e)
+	{
+		logGlobal->error("Failed to save map header cache %s: %s", cacheFile.string(), e.what());
+	}
+}
@@ -62,3 +62,43 @@ public:
 		h & isRandomMap;
 	}
 };
+
+/**
+ * A persistent cache of map headers, so that map list doesn't have to load every map file.
+ * Cached headers are used only if size and modification time of map file did not change.
+ */
+class DLL_LINKAGE CMapHeaderCache : public boost::noncopyable
+{
+public:
+	explicit CMapHeaderCache(boost::filesystem::path cacheFile);
+
+	/// initializes map info using cached header, or loads map header and adds it to cache
+	void mapInit(CMapInfo & info, const std::string & fname);
+
+	/// writes cache to disk if anything has changed, entries for maps not used since cache was loaded are dropped
+	void save();
+
+private:
+	struct Entry
+	{
+		ui64 size;
+		si64 modified;
+		CMapHeader header;
+
+		template <typename Handler> void serialize(Handler &h, const int Version)
+		{
+			h & size;
+			h & modified;
+			h & header;
+		}
+	};
+
+	/// checksum of active mods and loaded heroes, cached headers are only valid for the same game content
+	static ui32 calculateContentChecksum();
+
+	boost::filesystem::path cacheFile;
+	ui32 contentChecksum;
+	std::map<std::string, Entry> entries; //key is full path to map file
+	std::set<std::string> usedEntries;
+	bool changed;
+};
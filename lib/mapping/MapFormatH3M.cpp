@@ -16,6 +16,7 @@
 
 #include "../CStopWatch.h"
 #include "../filesystem/Filesystem.h"
+#include "../filesystem/CMemoryStream.h"
 #include "../spells/CSpellHandler.h"
 #include "../CCreatureHandler.h"
 #include "../CGeneralTextHandler.h"
@@ -57,20 +58,22 @@ std::unique_ptr<CMapHeader> CMapLoaderH3M::loadMapHeader()
 
 void CMapLoaderH3M::init()
 {
-	//FIXME: get rid of double input process
-	si64 temp_size = inputStream->getSize();
+	// Inflate whole map once and parse it from memory. Seeking back in compressed
+	// stream would decompress everything again, and small reads are much cheaper from memory.
+	si64 size = inputStream->getSize();
 	inputStream->seek(0);
 
-	auto  temp_buffer = new ui8[temp_size];
-	inputStream->read(temp_buffer,temp_size);
+	buffer.resize(size);
+	if(inputStream->read(buffer.data(), size) != size)
+		throw std::runtime_error("Failed to read map data");
 
 	// Compute checksum
 	boost::crc_32_type  result;
-	result.process_bytes(temp_buffer, temp_size);
+	result.process_bytes(buffer.data(), buffer.size());
 	map->checksum = result.checksum();
 
-	delete [] temp_buffer;
-	inputStream->seek(0);
+	bufferStream = make_unique<CMemoryStream>(buffer.data(), size);
+	reader.setStream(bufferStream.get());
 
 	CStopWatch sw;
 
@@ -129,7 +132,7 @@ void CMapLoaderH3M::init()
 			logGlobal->debug("\tReading %s took %d ms", mlt.name, mlt.time);
 		}
 	}
-	map->calculateGuardingGreaturePositions();
+	map->calculateGuardingGreaturePositions(true);
 	afterRead();
 }
 
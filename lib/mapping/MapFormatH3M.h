@@ -27,6 +27,7 @@ class IQuestObject;
 class CGTownInstance;
 class CCreatureSet;
 class CInputStream;
+class CMemoryStream;
 
 
 class DLL_LINKAGE CMapLoaderH3M : public IMapLoader
@@ -259,4 +260,8 @@ private:
 	CBinaryReader reader;
 	CInputStream * inputStream;
 
+	/** whole inflated map, read once in init() so that compressed input is not decompressed twice */
+	std::vector<ui8> buffer;
+	std::unique_ptr<CMemoryStream> bufferStream;
+
 };
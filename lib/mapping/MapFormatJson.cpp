@@ -901,7 +901,7 @@ void CMapLoaderJson::readMap()
 	readTerrain();
 	readObjects();
 
-	map->calculateGuardingGreaturePositions();
+	map->calculateGuardingGreaturePositions(true);
 }
 
 void CMapLoaderJson::readHeader(const bool complete)
@@ -1784,7 +1784,7 @@ void CRmgTemplateZone::createObstacles2()
 			auto handler = VLC->objtypeh->getHandlerFor(primaryID, secondaryID);
 			if (handler->isStaticObject())
 			{
-				for (auto temp : handler->getTemplates())
+				for (const auto & temp : handler->getTemplates())
 				{
 					if (temp.canBePlacedAt(terrainType) && temp.getBlockMapOffset().valid())
 						obstaclesBySize[temp.getBlockedOffsets().size()].push_back(temp);
@@ -2401,7 +2401,7 @@ void CRmgTemplateZone::addAllPossibleObjects()
 			auto handler = VLC->objtypeh->getHandlerFor(primaryID, secondaryID);
 			if (!handler->isStaticObject() && handler->getRMGInfo().value)
 			{
-				for (auto temp : handler->getTemplates())
+				for (const auto & temp : handler->getTemplates())
 				{
 					if (temp.canBePlacedAt(terrainType))
 					{
@@ -2485,7 +2485,7 @@ void CRmgTemplateZone::addAllPossibleObjects()
 			oi.value = cre->AIValue * cre->growth * (1 + (nativeZonesCount / gen->getTotalZoneCount()) + (nativeZonesCount / 2));
 			oi.probability = 40;
 
-			for (auto temp : dwellingHandler->getTemplates())
+			for (const auto & temp : dwellingHandler->getTemplates())
 			{
 				if (temp.canBePlacedAt(terrainType))
 				{
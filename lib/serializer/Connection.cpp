@@ -154,6 +154,8 @@ int CConnection::read(void * data, unsigned size)
 	try
 	{
 		int ret = asio::read(*socket,asio::mutable_buffers_1(asio::mutable_buffer(data,size)));
+		if(packFirstByteTime.is_not_a_date_time())
+			packFirstByteTime = boost::posix_time::microsec_clock::universal_time();
 		return ret;
 	}
 	catch(...)
@@ -219,7 +221,14 @@ CPack * CConnection::retreivePack()
 	CPack *ret = nullptr;
 	boost::unique_lock<boost::mutex> lock(*rmx);
 	logNetwork->trace("Listening... ");
+	const auto start = boost::posix_time::microsec_clock::universal_time();
+	packFirstByteTime = boost::posix_time::not_a_date_time;
 	iser & ret;
+	const auto end = boost::posix_time::microsec_clock::universal_time();
+	if(packFirstByteTime.is_not_a_date_time())
+		packFirstByteTime = end;
+	lastPackWaitTime = packFirstByteTime - start;
+	lastPackDecodeTime = end - packFirstByteTime;
 	logNetwork->trace("\treceived server message of type %s", (ret? typeid(*ret).name() : "nullptr"));
 	return ret;
 }
@@ -50,6 +50,8 @@ class DLL_LINKAGE CConnection
 
 	int write(const void * data, unsigned size) override;
 	int read(void * data, unsigned size) override;
+
+	boost::posix_time::ptime packFirstByteTime; //when first bytes of pack being retrieved have arrived
 public:
 	BinaryDeserializer iser;
 	BinarySerializer oser;
@@ -66,6 +68,9 @@ public:
 
 	bool receivedStop, sendStop;
 
+	/// Measured by retreivePack: time spent waiting for the first bytes of the last pack and time spent reading and decoding the rest
+	boost::posix_time::time_duration lastPackWaitTime, lastPackDecodeTime;
+
 	CConnection(std::string host, ui16 port, std::string Name);
 	CConnection(TAcceptor * acceptor, boost::asio::io_service *Io_service, std::string Name);
 	CConnection(TSocket * Socket, std::string Name); //use immediately after accepting connection into socket
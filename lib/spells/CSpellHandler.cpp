@@ -919,7 +919,7 @@ CSpell * CSpellHandler::loadFromJson(const JsonNode & json, const std::string &
 
 	auto readBonusStruct = [&](std::string name, std::vector<Bonus::BonusType> & vec)
 	{
-		for(auto bonusData: json[name].Struct())
+		for(auto & bonusData : json[name].Struct())
 		{
 			const std::string bonusId = bonusData.first;
 			const bool flag = bonusData.second.Bool();
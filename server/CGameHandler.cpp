@@ -118,6 +118,24 @@ static CApplier<CBaseForGHApply> *applier = nullptr;
 
 CMP_stack cmpst ;
 
+//checks if any triggered event of the map depends on given condition type
+static bool usesEventCondition(const CMap * map, EventCondition::EWinLoseType type)
+{
+	bool found = false;
+	for(const TriggeredEvent & event : map->triggeredEvents)
+	{
+		event.trigger.morph([&](const EventCondition & condition) -> EventExpression::Variant
+		{
+			if(condition.condition == type)
+				found = true;
+			return condition;
+		});
+		if(found)
+			return true;
+	}
+	return false;
+}
+
 static inline double distance(int3 a, int3 b)
 {
 	return std::sqrt((double)(a.x-b.x)*(a.x-b.x) + (a.y-b.y)*(a.y-b.y));
@@ -1480,6 +1498,7 @@ void CGameHandler::setPortalDwelling(const CGTownInstance * town, bool forced=fa
 void CGameHandler::newTurn()
 {
 	logGlobal->trace("Turn %d", gs->day+1);
+	const auto turnStart = boost::posix_time::microsec_clock::universal_time();
 	NewTurn n;
 	n.specialWeek = NewTurn::NO_ACTION;
 	n.creatureid = CreatureID::NONE;
@@ -1710,10 +1729,16 @@ void CGameHandler::newTurn()
 				// find all hidden tiles
 				const auto & fow = getPlayerTeam(player)->fogOfWarMap;
 				for (size_t i=0; i<fow.size(); i++)
-					for (size_t j=0; j<fow.at(i).size(); j++)
-						for (size_t k=0; k<fow.at(i).at(j).size(); k++)
-							if (!fow.at(i).at(j).at(k))
+				{
+					const auto & column = fow[i];
+					for (size_t j=0; j<column.size(); j++)
+					{
+						const auto & tile = column[j];
+						for (size_t k=0; k<tile.size(); k++)
+							if (!tile[k])
 								fw.tiles.insert(int3(i,j,k));
+					}
+				}
 
 				sendAndApply (&fw);
 			}
@@ -1803,6 +1828,9 @@ void CGameHandler::newTurn()
 	}
 
 	synchronizeArtifactHandlerLists(); //new day events may have changed them. TODO better of managing that
+
+	const auto turnTime = boost::posix_time::microsec_clock::universal_time() - turnStart;
+	logGlobal->debug("New turn %d processed in %d ms", n.day, turnTime.total_milliseconds());
 }
 void CGameHandler::run(bool resume)
 {
@@ -2209,6 +2237,28 @@ bool CGameHandler::moveHero(ObjectInstanceID hid, int3 dst, ui8 teleporting, boo
 	}
 }
 
+bool CGameHandler::moveHeroPath(ObjectInstanceID hid, const std::vector<MoveHeroPath::Step> & steps, PlayerColor asker)
+{
+	const CGHeroInstance *h = getHero(hid);
+	if (!h)
+		COMPLAIN_RET("Illegal call to move hero along path!");
+
+	const PlayerColor owner = h->tempOwner;
+	logGlobal->trace("Player %s wants to move hero %d along path of %d steps", asker.getStr(), hid.getNum(), steps.size());
+
+	for (const auto & step : steps)
+	{
+		if (!moveHero(hid, step.dest, 0, step.transit, asker))
+			return false;
+
+		//stop on first interruption: hero lost, stopped by blocking visit or waiting for battle or dialog
+		h = getHero(hid);
+		if (!h || h->pos != step.dest || queries.topQuery(owner) || gs->curB)
+			break;
+	}
+	return true;
+}
+
 bool CGameHandler::teleportHero(ObjectInstanceID hid, ObjectInstanceID dstid, ui8 source, PlayerColor asker)
 {
 	const CGHeroInstance *h = getHero(hid);
@@ -2620,19 +2670,23 @@ void CGameHandler::applyAndSend(CPackForClient * info)
 void CGameHandler::sendAndApply(CGarrisonOperationPack * info)
 {
 	sendAndApply(static_cast<CPackForClient*>(info));
-	checkVictoryLossConditionsForAll();
+	//garrison operations can only affect creature count conditions
+	if(usesEventCondition(gs->map, EventCondition::HAVE_CREATURES))
+		checkVictoryLossConditionsForAll();
 }
 
 void CGameHandler::sendAndApply(SetResources * info)
 {
 	sendAndApply(static_cast<CPackForClient*>(info));
-	checkVictoryLossConditionsForPlayer(info->player);
+	if(usesEventCondition(gs->map, EventCondition::HAVE_RESOURCES))
+		checkVictoryLossConditionsForPlayer(info->player);
 }
 
 void CGameHandler::sendAndApply(NewStructures * info)
 {
 	sendAndApply(static_cast<CPackForClient*>(info));
-	checkVictoryLossConditionsForPlayer(getTown(info->tid)->tempOwner);
+	if(usesEventCondition(gs->map, EventCondition::HAVE_BUILDING))
+		checkVictoryLossConditionsForPlayer(getTown(info->tid)->tempOwner);
 }
 
 void CGameHandler::save(const std::string & filename)
@@ -4312,6 +4366,8 @@ bool CGameHandler::makeBattleAction(BattleAction &ba)
 		handleDamageFromObstacle(stack);
 	if(ba.stackNumber == gs->curB->activeStack || battleResult.get()) //active stack has moved or battle has finished
 		battleMadeAction.setn(true);
+	else if(ba.actionType == Battle::END_TACTIC_PHASE)
+		notifyBattleThread();
 	return ok;
 }
 
@@ -5375,7 +5431,7 @@ void CGameHandler::handleAfterAttackCasting(const BattleAttack & bat)
 		double chanceToTrigger = attacker->valOfBonuses(Bonus::TRANSMUTATION) / 100.0f;
 		vstd::amin(chanceToTrigger, 1); //cap at 100%
 
-		if(getRandomGenerator().getDoubleRange(0, 1)() > chanceToTrigger)
+		if(getRandomGenerator().nextDouble(0, 1) > chanceToTrigger)
 			return;
 
 		int bonusAdditionalInfo = attacker->getBonus(Selector::type(Bonus::TRANSMUTATION))->additionalInfo;
@@ -5678,10 +5734,14 @@ void CGameHandler::runBattle()
 	assert(gs->curB);
 	//TODO: pre-tactic stuff, call scripts etc.
 
+	const auto battleStart = boost::posix_time::microsec_clock::universal_time();
+	int stackTurns = 0;
+
 	//tactic round
 	{
+		boost::unique_lock<boost::mutex> lock(battleMadeAction.mx);
 		while (gs->curB->tacticDistance && !battleResult.get())
-			boost::this_thread::sleep(boost::posix_time::milliseconds(50));
+			battleMadeAction.cond.wait(lock);
 	}
 
 	//initial stacks appearance triggers, e.g. built-in bonus spells
@@ -5778,6 +5838,8 @@ void CGameHandler::runBattle()
 		const CStack *next;
 		while (!battleResult.get() && (next = curB.getNextStack()) && next->willMove())
 		{
+			stackTurns++;
+
 			std::set <const CStack *> stacksToRemove;
 			for (auto stack : curB.stacks)
 			{
@@ -6005,6 +6067,10 @@ void CGameHandler::runBattle()
 		firstRound = false;
 	}
 
+	const auto battleTime = boost::posix_time::microsec_clock::universal_time() - battleStart;
+	logGlobal->debug("Battle ended after %d rounds and %d stack turns, took %d ms (%d ms per stack turn)",
+		gs->curB->round, stackTurns, battleTime.total_milliseconds(), battleTime.total_milliseconds() / std::max(stackTurns, 1));
+
 	endBattle(gs->curB->tile, gs->curB->battleGetFightingHero(0), gs->curB->battleGetFightingHero(1));
 }
 
@@ -6091,18 +6157,29 @@ void CGameHandler::giveHeroNewArtifact(const CGHeroInstance *h, const CArtifact
 
 void CGameHandler::setBattleResult(BattleResult::EResult resultType, int victoriusSide)
 {
-	boost::unique_lock<boost::mutex> guard(battleResult.mx);
-	if (battleResult.data)
 	{
-		complain((boost::format("The battle result has been already set (to %d, asked to %d)")
-		          % battleResult.data->result % resultType).str());
-		return;
+		boost::unique_lock<boost::mutex> guard(battleResult.mx);
+		if (battleResult.data)
+		{
+			complain((boost::format("The battle result has been already set (to %d, asked to %d)")
+			          % battleResult.data->result % resultType).str());
+			return;
+		}
+		auto br = new BattleResult();
+		br->result = resultType;
+		br->winner = victoriusSide; //surrendering side loses
+		gs->curB->calculateCasualties(br->casualties);
+		battleResult.data = br;
 	}
-	auto br = new BattleResult();
-	br->result = resultType;
-	br->winner = victoriusSide; //surrendering side loses
-	gs->curB->calculateCasualties(br->casualties);
-	battleResult.data = br;
+	//battle thread may be waiting for end of tactic phase
+	notifyBattleThread();
+}
+
+void CGameHandler::notifyBattleThread()
+{
+	//lock so that notification can't be lost between check of battle state and wait in battle thread
+	boost::unique_lock<boost::mutex> lock(battleMadeAction.mx);
+	battleMadeAction.cond.notify_all();
 }
 
 void CGameHandler::commitPackage(CPackForClient *pack)
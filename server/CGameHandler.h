@@ -107,6 +107,7 @@ public:
 	void checkBattleStateChanges();
 	void setupBattle(int3 tile, const CArmedInstance *armies[2], const CGHeroInstance *heroes[2], bool creatureBank, const CGTownInstance *town);
 	void setBattleResult(BattleResult::EResult resultType, int victoriusSide);
+	void notifyBattleThread();
 
 	CGameHandler(void);
 	~CGameHandler(void);
@@ -173,6 +174,7 @@ public:
 	void useScholarSkill(ObjectInstanceID hero1, ObjectInstanceID hero2);
 	void setPortalDwelling(const CGTownInstance * town, bool forced, bool clear);
 	void visitObjectOnTile(const TerrainTile &t, const CGHeroInstance * h);
+	bool moveHeroPath(ObjectInstanceID hid, const std::vector<MoveHeroPath::Step> & steps, PlayerColor asker = PlayerColor::NEUTRAL);
 	bool teleportHero(ObjectInstanceID hid, ObjectInstanceID dstid, ui8 source, PlayerColor asker = PlayerColor::NEUTRAL);
 	void vistiCastleObjects (const CGTownInstance *t, const CGHeroInstance *h);
 	void levelUpHero(const CGHeroInstance * hero, SecondarySkill skill);//handle client respond and send one more request if needed
@@ -0,0 +1,72 @@
+/*
+ * CRandomGeneratorTest.cpp, part of VCMI engine
+ *
+ * Authors: listed in file AUTHORS in main folder
+ *
+ * License: GNU General Public License v2.0 or later
+ * Full text of license available in license.txt file, in main folder
+ *
+ */
+
+#include "StdInc.h"
+#include "../lib/CRandomGenerator.h"
+#include "../lib/serializer/CMemorySerializer.h"
+
+struct CRandomGeneratorTest : testing::Test
+{
+	CRandomGenerator subject;
+	CRandomGenerator reference;
+
+	CRandomGeneratorTest()
+	{
+		subject.setSeed(42);
+		reference.setSeed(42);
+	}
+};
+
+TEST_F(CRandomGeneratorTest, engineIsMersenneTwister)
+{
+	//saved games store the engine state, changing the engine breaks them
+	subject.setSeed(5489);
+	subject.getStdGenerator().discard(9999);
+	EXPECT_EQ(subject.getStdGenerator()(), 4123659995u);
+}
+
+TEST_F(CRandomGeneratorTest, nextIntMatchesIntRange)
+{
+	auto range = reference.getIntRange(-5, 17);
+	for(int i = 0; i < 1000; i++)
+		EXPECT_EQ(subject.nextInt(-5, 17), range());
+}
+
+TEST_F(CRandomGeneratorTest, nextDoubleMatchesDoubleRange)
+{
+	auto range = reference.getDoubleRange(0.5, 2.5);
+	for(int i = 0; i < 1000; i++)
+		EXPECT_EQ(subject.nextDouble(0.5, 2.5), range());
+}
+
+TEST_F(CRandomGeneratorTest, fillIntRangeMatchesNextInt)
+{
+	std::vector<int> rolls(1000);
+	subject.fillIntRange(rolls.begin(), rolls.end(), 1, 100);
+
+	for(int roll : rolls)
+		EXPECT_EQ(roll, reference.nextInt(1, 100));
+	EXPECT_EQ(subject.nextInt(), reference.nextInt());
+}
+
+TEST_F(CRandomGeneratorTest, serializationKeepsStream)
+{
+	for(int i = 0; i < 100; i++)
+		subject.nextInt();
+
+	CMemorySerializer mem;
+	mem.oser & subject;
+
+	CRandomGenerator restored;
+	mem.iser & restored;
+
+	for(int i = 0; i < 1000; i++)
+		EXPECT_EQ(restored.nextInt(0, 99), subject.nextInt(0, 99));
+}
@@ -0,0 +1,61 @@
+/*
+ * CThreadHelperTest.cpp, part of VCMI engine
+ *
+ * Authors: listed in file AUTHORS in main folder
+ *
+ * License: GNU General Public License v2.0 or later
+ * Full text of license available in license.txt file, in main folder
+ *
+ */
+
+#include "StdInc.h"
+#include "../lib/CThreadHelper.h"
+
+static void runTasks(size_t taskCount, int threads, std::vector<int> & counters)
+{
+	counters.assign(taskCount, 0);
+	std::vector<Task> tasks;
+	for(size_t i = 0; i < taskCount; i++)
+	{
+		int * counter = &counters[i];
+		tasks.push_back([counter](){ ++(*counter); });
+	}
+
+	CThreadHelper helper(&tasks, threads);
+	helper.run();
+}
+
+TEST(CThreadHelperTest, runsEachTaskOnce)
+{
+	std::vector<int> counters;
+	runTasks(100, 4, counters);
+
+	for(int counter : counters)
+		EXPECT_EQ(counter, 1);
+}
+
+TEST(CThreadHelperTest, singleThread)
+{
+	std::vector<int> counters;
+	runTasks(4, 1, counters);
+
+	for(int counter : counters)
+		EXPECT_EQ(counter, 1);
+}
+
+TEST(CThreadHelperTest, moreThreadsThanTasks)
+{
+	std::vector<int> counters;
+	runTasks(2, 8, counters);
+
+	for(int counter : counters)
+		EXPECT_EQ(counter, 1);
+}
+
+TEST(CThreadHelperTest, noTasks)
+{
+	std::vector<int> counters;
+	runTasks(0, 4, counters);
+
+	EXPECT_TRUE(counters.empty());
+}
@@ -0,0 +1,394 @@
+/*
+ * CDamageCalculationTest.cpp, part of VCMI engine
+ *
+ * Authors: listed in file AUTHORS in main folder
+ *
+ * License: GNU General Public License v2.0 or later
+ * Full text of license available in license.txt file, in main folder
+ *
+ */
+
+#include "StdInc.h"
+#include "../../lib/battle/BattleInfo.h"
+#include "../../lib/CStack.h"
+#include "../../lib/CCreatureHandler.h"
+#include "../../lib/VCMI_Lib.h"
+#include "../../lib/spells/CSpellHandler.h"
+
+/// Damage formula as it was before bonus values were extracted into AttackerDamageStats and DefenderDamageStats.
+/// Arrow towers are not covered as they do not use bonuses for damage.
+static TDmgRange referenceDmgRange(const CBattleInfoCallback & cb, const BattleAttackInfo & info)
+{
+	auto battleBonusValue = [&](const IBonusBearer * bearer, CSelector selector) -> int
+	{
+		auto noLimit = Selector::effectRange(Bonus::NO_LIMIT);
+		auto limitMatches = info.shooting
+							? Selector::effectRange(Bonus::ONLY_DISTANCE_FIGHT)
+							: Selector::effectRange(Bonus::ONLY_MELEE_FIGHT);
+
+		return bearer->getBonuses(selector, noLimit.Or(limitMatches))->totalValue();
+	};
+
+	double additiveBonus = 1.0, multBonus = 1.0,
+			minDmg = info.attackerBonuses->getMinDamage() * info.attackerHealth.getCount(),
+			maxDmg = info.attackerBonuses->getMaxDamage() * info.attackerHealth.getCount();
+
+	const CCreature *attackerType = info.attacker->getCreature(),
+			*defenderType = info.defender->getCreature();
+
+	if(info.attackerBonuses->hasBonusOfType(Bonus::SIEGE_WEAPON))
+	{
+		const std::shared_ptr<Bonus> b = info.attackerBonuses->getBonus(Selector::sourceTypeSel(Bonus::HERO_BASE_SKILL).And(Selector::typeSubtype(Bonus::PRIMARY_SKILL, PrimarySkill::ATTACK)));
+		const int heroAttack = b ? b->val : 0;
+		minDmg *= heroAttack + 1;
+		maxDmg *= heroAttack + 1;
+	}
+
+	int attackDefenceDifference = 0;
+
+	double multAttackReduction = (100 - battleBonusValue(info.attackerBonuses, Selector::type(Bonus::GENERAL_ATTACK_REDUCTION))) / 100.0;
+	attackDefenceDifference += battleBonusValue(info.attackerBonuses, Selector::typeSubtype(Bonus::PRIMARY_SKILL, PrimarySkill::ATTACK)) * multAttackReduction;
+
+	double multDefenceReduction = (100 - battleBonusValue(info.attackerBonuses, Selector::type(Bonus::ENEMY_DEFENCE_REDUCTION))) / 100.0;
+	attackDefenceDifference -= info.defenderBonuses->Defense() * multDefenceReduction;
+
+	if(const std::shared_ptr<Bonus> slayerEffect = info.attackerBonuses->getBonus(Selector::type(Bonus::SLAYER)))
+	{
+		std::vector<int> affectedIds;
+		int spLevel = slayerEffect->val;
+
+		for(int g = 0; g < VLC->creh->creatures.size(); ++g)
+		{
+			for(const std::shared_ptr<Bonus> b : VLC->creh->creatures[g]->getBonusList())
+			{
+				if ((b->type == Bonus::KING3 && spLevel >= 3) ||
+					 (b->type == Bonus::KING2 && spLevel >= 2) ||
+					 (b->type == Bonus::KING1 && spLevel >= 0))
+				{
+					affectedIds.push_back(g);
+					break;
+				}
+			}
+		}
+
+		for(auto & affectedId : affectedIds)
+		{
+			if(defenderType->idNumber == affectedId)
+			{
+				attackDefenceDifference += SpellID(SpellID::SLAYER).toSpell()->getPower(spLevel);
+				break;
+			}
+		}
+	}
+
+	if(attackDefenceDifference < 0)
+		multBonus *= 1.0 - std::min(0.025 * (-attackDefenceDifference), 0.7);
+	else
+		additiveBonus += std::min(0.05 * attackDefenceDifference, 4.0);
+
+	if(info.attackerBonuses->hasBonusOfType(Bonus::JOUSTING) && !info.defenderBonuses->hasBonusOfType(Bonus::CHARGE_IMMUNITY))
+		additiveBonus += info.chargedFields * 0.05;
+
+	if(info.shooting)
+		additiveBonus += info.attackerBonuses->valOfBonuses(Bonus::SECONDARY_SKILL_PREMY, SecondarySkill::ARCHERY) / 100.0;
+	else
+		additiveBonus += info.attackerBonuses->valOfBonuses(Bonus::SECONDARY_SKILL_PREMY, SecondarySkill::OFFENCE) / 100.0;
+
+	multBonus *= (std::max(0, 100 - info.defenderBonuses->valOfBonuses(Bonus::SECONDARY_SKILL_PREMY, SecondarySkill::ARMORER))) / 100.0;
+
+	additiveBonus += info.attackerBonuses->valOfBonuses(Bonus::HATE, defenderType->idNumber.toEnum()) / 100.;
+
+	if(info.luckyHit)
+		additiveBonus += 1.0;
+	if(info.unluckyHit)
+		additiveBonus -= 0.5;
+	if(info.ballistaDoubleDamage)
+		additiveBonus += 1.0;
+	if(info.deathBlow)
+		additiveBonus += 1.0;
+
+	multBonus *= (100 - info.defenderBonuses->valOfBonuses(Bonus::GENERAL_DAMAGE_REDUCTION, info.shooting ? 1 : 0)) / 100.0;
+
+	if(info.shooting)
+	{
+		TBonusListPtr forgetfulList = info.attackerBonuses->getBonuses(Selector::type(Bonus::FORGETFULL),"");
+
+		if(!forgetfulList->empty())
+		{
+			int forgetful = forgetfulList->valOfBonuses(Selector::type(Bonus::FORGETFULL));
+			if(forgetful == 0 || forgetful == 1)
+				multBonus *= 0.5;
+		}
+	}
+
+	TBonusListPtr curseEffects = info.attackerBonuses->getBonuses(Selector::type(Bonus::ALWAYS_MINIMUM_DAMAGE));
+	TBonusListPtr blessEffects = info.attackerBonuses->getBonuses(Selector::type(Bonus::ALWAYS_MAXIMUM_DAMAGE));
+	int curseBlessAdditiveModifier = blessEffects->totalValue() - curseEffects->totalValue();
+	double curseMultiplicativePenalty = curseEffects->size() ? (*std::max_element(curseEffects->begin(), curseEffects->end(), &Bonus::compareByAdditionalInfo<std::shared_ptr<Bonus>>))->additionalInfo : 0;
+
+	if(curseMultiplicativePenalty)
+		multBonus *= 1.0 - curseMultiplicativePenalty/100;
+
+	auto isAdvancedAirShield = [](const Bonus* bonus)
+	{
+		return bonus->source == Bonus::SPELL_EFFECT
+				&& bonus->sid == SpellID::AIR_SHIELD
+				&& bonus->val >= SecSkillLevel::ADVANCED;
+	};
+
+	const bool distPenalty = !info.attackerBonuses->hasBonusOfType(Bonus::NO_DISTANCE_PENALTY) && cb.battleHasDistancePenalty(info.attackerBonuses, info.attackerPosition, info.defenderPosition);
+	const bool obstaclePenalty = cb.battleHasWallPenalty(info.attackerBonuses, info.attackerPosition, info.defenderPosition);
+
+	if(info.shooting)
+	{
+		if(distPenalty || info.defenderBonuses->hasBonus(isAdvancedAirShield))
+			multBonus *= 0.5;
+		if(obstaclePenalty)
+			multBonus *= 0.5;
+	}
+	if(!info.shooting && info.attackerBonuses->hasBonusOfType(Bonus::SHOOTER) && !info.attackerBonuses->hasBonusOfType(Bonus::NO_MELEE_PENALTY))
+		multBonus *= 0.5;
+
+	if(attackerType->idNumber == CreatureID::PSYCHIC_ELEMENTAL && info.defenderBonuses->hasBonusOfType(Bonus::MIND_IMMUNITY))
+		multBonus *= 0.5;
+
+	minDmg *= additiveBonus * multBonus;
+	maxDmg *= additiveBonus * multBonus;
+
+	TDmgRange returnedVal;
+
+	if(curseEffects->size())
+	{
+		minDmg += curseBlessAdditiveModifier;
+		returnedVal = std::make_pair(int(minDmg), int(minDmg));
+	}
+	else if(blessEffects->size())
+	{
+		maxDmg += curseBlessAdditiveModifier;
+		returnedVal = std::make_pair(int(maxDmg), int(maxDmg));
+	}
+	else
+	{
+		returnedVal = std::make_pair(int(minDmg), int(maxDmg));
+	}
+
+	vstd::amax(returnedVal.first, 1);
+	vstd::amax(returnedVal.second, 1);
+
+	return returnedVal;
+}
+
+static const CCreature * findCreatureWithBonus(Bonus::BonusType type)
+{
+	for(const CCreature * creature : VLC->creh->creatures)
+	{
+		for(const std::shared_ptr<Bonus> b : creature->getBonusList())
+		{
+			if(b->type == type)
+				return creature;
+		}
+	}
+	return nullptr;
+}
+
+class DamageCalculationTest : public ::testing::Test
+{
+public:
+	BattleInfo battle;
+	std::unique_ptr<CStack> attacker, defender;
+
+	void setupStacks(CreatureID attackerType, CreatureID defenderType, BattleHex attackerPos = 50, BattleHex defenderPos = 52)
+	{
+		setupStacks(attackerType.toCreature(), defenderType.toCreature(), attackerPos, defenderPos);
+	}
+
+	void setupStacks(const CCreature * attackerType, const CCreature * defenderType, BattleHex attackerPos = 50, BattleHex defenderPos = 52)
+	{
+		battle.stacks.clear();
+		attacker = makeStack(attackerType, 0, attackerPos);
+		defender = makeStack(defenderType, 1, defenderPos);
+	}
+
+	std::shared_ptr<Bonus> addBonus(CStack * stack, Bonus::BonusType type, si32 val, si32 subtype = -1, Bonus::BonusSource source = Bonus::SPELL_EFFECT, ui32 sourceID = 0)
+	{
+		auto bonus = std::make_shared<Bonus>(Bonus::ONE_BATTLE, type, source, val, sourceID, subtype);
+		stack->addNewBonus(bonus);
+		return bonus;
+	}
+
+	BattleAttackInfo attackInfo(bool shooting) const
+	{
+		return BattleAttackInfo(attacker.get(), defender.get(), shooting);
+	}
+
+	void expectSameDamage(const BattleAttackInfo & info)
+	{
+		const TDmgRange expected = referenceDmgRange(battle, info);
+		EXPECT_EQ(expected, battle.calculateDmgRange(info));
+
+		DamageStatsCache cache;
+		EXPECT_EQ(expected, battle.calculateDmgRange(info, cache));
+		EXPECT_EQ(expected, battle.calculateDmgRange(info, cache)); //second time with cached stats
+	}
+
+	void expectSameDamage()
+	{
+		expectSameDamage(attackInfo(false));
+		expectSameDamage(attackInfo(true));
+	}
+
+private:
+	std::unique_ptr<CStack> makeStack(const CCreature * type, ui8 side, BattleHex position)
+	{
+		CStackBasicDescriptor base(type, 10);
+		auto stack = make_unique<CStack>(&base, PlayerColor(side), battle.stacks.size(), side);
+		stack->position = position;
+		stack->state.insert(EBattleStackState::ALIVE);
+		stack->attachTo(const_cast<CCreature *>(type));
+		stack->health.init();
+		battle.stacks.push_back(stack.get());
+		return stack;
+	}
+};
+
+TEST_F(DamageCalculationTest, plainAttack)
+{
+	setupStacks(CreatureID::CAVALIER, CreatureID::STONE_GOLEM);
+	expectSameDamage();
+}
+
+TEST_F(DamageCalculationTest, attackModifiers)
+{
+	setupStacks(CreatureID::CAVALIER, CreatureID::STONE_GOLEM);
+	addBonus(attacker.get(), Bonus::PRIMARY_SKILL, 12, PrimarySkill::ATTACK)->effectRange = Bonus::ONLY_MELEE_FIGHT;
+	addBonus(attacker.get(), Bonus::PRIMARY_SKILL, 5, PrimarySkill::ATTACK)->effectRange = Bonus::ONLY_DISTANCE_FIGHT;
+	addBonus(attacker.get(), Bonus::GENERAL_ATTACK_REDUCTION, 25);
+	addBonus(attacker.get(), Bonus::ENEMY_DEFENCE_REDUCTION, 40);
+	addBonus(attacker.get(), Bonus::SECONDARY_SKILL_PREMY, 20, SecondarySkill::OFFENCE, Bonus::SECONDARY_SKILL);
+	addBonus(attacker.get(), Bonus::SECONDARY_SKILL_PREMY, 50, SecondarySkill::ARCHERY, Bonus::SECONDARY_SKILL);
+	addBonus(attacker.get(), Bonus::HATE, 50, CreatureID::STONE_GOLEM, Bonus::CREATURE_ABILITY);
+	addBonus(defender.get(), Bonus::PRIMARY_SKILL, 30, PrimarySkill::DEFENSE);
+	addBonus(defender.get(), Bonus::SECONDARY_SKILL_PREMY, 15, SecondarySkill::ARMORER, Bonus::SECONDARY_SKILL);
+	addBonus(defender.get(), Bonus::GENERAL_DAMAGE_REDUCTION, 30, 0);
+	expectSameDamage();
+
+	auto info = attackInfo(false);
+	info.luckyHit = true;
+	info.deathBlow = true;
+	expectSameDamage(info);
+
+	info.luckyHit = false;
+	info.unluckyHit = true;
+	expectSameDamage(info);
+}
+
+TEST_F(DamageCalculationTest, jousting)
+{
+	setupStacks(CreatureID::CHAMPION, CreatureID::STONE_GOLEM);
+	addBonus(attacker.get(), Bonus::JOUSTING, 0, -1, Bonus::CREATURE_ABILITY);
+
+	auto info = attackInfo(false);
+	info.chargedFields = 5;
+	expectSameDamage(info);
+
+	addBonus(defender.get(), Bonus::CHARGE_IMMUNITY, 0, -1, Bonus::CREATURE_ABILITY);
+	expectSameDamage(info);
+}
+
+TEST_F(DamageCalculationTest, slayerVersusKings)
+{
+	const CCreature * kings[] =
+	{
+		findCreatureWithBonus(Bonus::KING1),
+		findCreatureWithBonus(Bonus::KING2),
+		findCreatureWithBonus(Bonus::KING3),
+		CreatureID(CreatureID::STONE_GOLEM).toCreature()
+	};
+
+	for(const CCreature * king : kings)
+	{
+		ASSERT_NE(nullptr, king);
+		for(int level = 0; level <= 3; level++)
+		{
+			setupStacks(CreatureID(CreatureID::CAVALIER).toCreature(), king);
+			addBonus(attacker.get(), Bonus::SLAYER, level, -1, Bonus::SPELL_EFFECT, SpellID::SLAYER);
+			expectSameDamage();
+		}
+	}
+}
+
+TEST_F(DamageCalculationTest, curseAndBless)
+{
+	setupStacks(CreatureID::CAVALIER, CreatureID::STONE_GOLEM);
+	addBonus(attacker.get(), Bonus::ALWAYS_MINIMUM_DAMAGE, 1, -1, Bonus::SPELL_EFFECT, SpellID::CURSE)->additionalInfo = 20;
+	expectSameDamage();
+
+	setupStacks(CreatureID::CAVALIER, CreatureID::STONE_GOLEM);
+	addBonus(attacker.get(), Bonus::ALWAYS_MAXIMUM_DAMAGE, 3, -1, Bonus::SPELL_EFFECT, SpellID::BLESS);
+	expectSameDamage();
+
+	addBonus(attacker.get(), Bonus::ALWAYS_MINIMUM_DAMAGE, 0, -1, Bonus::SPELL_EFFECT, SpellID::CURSE)->additionalInfo = 10;
+	addBonus(attacker.get(), Bonus::ALWAYS_MINIMUM_DAMAGE, 1, -1, Bonus::ARTIFACT)->additionalInfo = 30;
+	expectSameDamage();
+}
+
+TEST_F(DamageCalculationTest, forgetfulness)
+{
+	for(int level = 0; level <= 3; level++)
+	{
+		setupStacks(CreatureID::LICHES, CreatureID::STONE_GOLEM);
+		addBonus(attacker.get(), Bonus::FORGETFULL, level, -1, Bonus::SPELL_EFFECT, SpellID::FORGETFULNESS);
+		expectSameDamage();
+	}
+}
+
+TEST_F(DamageCalculationTest, advancedAirShield)
+{
+	//value of air shield bonus is compared against skill level to detect advanced+ variant
+	for(int value : std::vector<int>{SecSkillLevel::BASIC, SecSkillLevel::ADVANCED, SecSkillLevel::EXPERT, 50})
+	{
+		setupStacks(CreatureID::LICHES, CreatureID::STONE_GOLEM);
+		addBonus(defender.get(), Bonus::GENERAL_DAMAGE_REDUCTION, value, 1, Bonus::SPELL_EFFECT, SpellID::AIR_SHIELD);
+		expectSameDamage();
+	}
+}
+
+TEST_F(DamageCalculationTest, siegeWeapon)
+{
+	setupStacks(CreatureID::BALLISTA, CreatureID::STONE_GOLEM);
+	addBonus(attacker.get(), Bonus::SIEGE_WEAPON, 0, -1, Bonus::CREATURE_ABILITY);
+	expectSameDamage();
+
+	addBonus(attacker.get(), Bonus::PRIMARY_SKILL, 7, PrimarySkill::ATTACK, Bonus::HERO_BASE_SKILL);
+	expectSameDamage();
+
+	auto info = attackInfo(true);
+	info.ballistaDoubleDamage = true;
+	expectSameDamage(info);
+}
+
+TEST_F(DamageCalculationTest, shooterPenalties)
+{
+	//melee penalty
+	setupStacks(CreatureID::LICHES, CreatureID::STONE_GOLEM);
+	addBonus(attacker.get(), Bonus::SHOOTER, 0, -1, Bonus::CREATURE_ABILITY);
+	expectSameDamage();
+
+	addBonus(attacker.get(), Bonus::NO_MELEE_PENALTY, 0, -1, Bonus::CREATURE_ABILITY);
+	expectSameDamage();
+
+	//distance penalty
+	setupStacks(CreatureID::LICHES, CreatureID::STONE_GOLEM, 18, 150);
+	addBonus(attacker.get(), Bonus::SHOOTER, 0, -1, Bonus::CREATURE_ABILITY);
+	expectSameDamage();
+
+	addBonus(attacker.get(), Bonus::NO_DISTANCE_PENALTY, 0, -1, Bonus::CREATURE_ABILITY);
+	expectSameDamage();
+}
+
+TEST_F(DamageCalculationTest, psychicElementalVersusMindImmunity)
+{
+	setupStacks(CreatureID::PSYCHIC_ELEMENTAL, CreatureID::SKELETON);
+	addBonus(defender.get(), Bonus::MIND_IMMUNITY, 0, -1, Bonus::CREATURE_ABILITY);
+	expectSameDamage();
+}